@@ -1,30 +1,81 @@
+#ifndef _POSIX_C_SOURCE
+#define _POSIX_C_SOURCE 200809L
+#endif
+#ifndef _XOPEN_SOURCE
+#define _XOPEN_SOURCE 700
+#endif
+
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 #include <stdbool.h>
+#include <threads.h>
+#include <dirent.h>
+#include <unistd.h>
+#include <limits.h>
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <stdint.h>
+#include <stdatomic.h>
 
 #define LEFT_PATH 0
 #define RIGHT_PATH 1
+#define BUNIEK_V_SLOVE 10
+#define VELKOST_BUFFERA_PARSERA 65536
 
-const char *HELP = "Syntax: {argv[0]} <command> [R] [C] [FILE]\n"
+const char *HELP = "Syntax: {argv[0]} [--mem-report] [--low-memory] <command> [R] [C] [FILE]\n"
                    "        {argv[0]} --help\n"
                    "   *<command> is mandatory but mutually exclusive\n" 
                    "Commands:\n"    
                    "       --test [FILE]: Testing allocating memory and validity of the file.\n"
                    "       --rpath [R] [C] [FILE]: Goes through the maze by holding a wall with the RIGHT hand, prints out the cells it went through\n"
                    "       --lpath [R] [C] [FILE]: Goes through the maze by holding a wall with the LEFT hand, prints out the cells it went through\n"
+                   "       --rpath/--lpath [R] [C] [FILE] --checkpoint [CKPT]: Same as above, the walk state is periodically saved to CKPT\n"
+                   "       --summary [FILE]: For every border cell prints the exit cell and length (lpath:R,C/N rpath:R,C/N) of both walks,\n"
+                   "                         answered from one jump table per hand, \"-\" is an invalid entrance and \"loop\" a walk that never exits\n"
+                   "       --resume [CKPT]: Continues a walk saved by --checkpoint, append its output to the original file (>>)\n"
+                   "       --entrances [FILE]: Lists every border cell, whether it is a valid entrance and the starting direction for both hands\n"
+                   "       --goto [R1] [C1] [R2] [C2] [FILE]: Prints the shortest path from cell R1,C1 to cell R2,C2 found by A*,\n"
+                   "                                          the number of expanded cells is printed to stderr\n"
+                   "       --prune [FILE] [OUT]: Seals all dead-end corridors and saves the reduced maze to OUT\n"
+                   "       --shortest [R] [C] [FILE]: Prints the shortest path from the entrance R,C to the nearest other exit\n"
+                   "       --junctions [FILE]: Prints the size of the junction graph the maze contracts to\n"
+                   "       --render [FILE] [OUT] [--rpath R C | --lpath R C]: Draws the maze into the PPM image OUT, optionally with the path\n"
+                   "                                          of one hand, the triangle size can be set by the MAZE_RENDER_SCALE environment variable\n"
+                   "       --dir <command> [R] [C] [DIR]: Runs --test, --rpath, --lpath or --entrances on every *.txt maze in DIR in parallel,\n"
+                   "                                      results are printed in file name order, each under a [FILE] header\n"
+                   "Options:\n"
+                   "       --mem-report: On exit prints the peak bytes of map cells, entrance table, parser buffers and solver scratch to stderr\n"
+                   "       --low-memory: Stores cells packed in 3 bits and solves --goto by BFS with a sparse visited bitmap\n"
                    "Arguments:\n"
                    "       [R]: Row, in which you want to start solving the maze\n"
                    "       [C]: Column, in which you want to start solving the maze\n"
-                   "       [File]: Address of the file, in which the maze is\n";
+                   "       [File]: Address of the file, in which the maze is\n"
+                   "       [DIR]: Directory with mazes, the number of threads can be set by the MAZE_THREADS environment variable\n";
 
 typedef struct
 {
     int rows;
     int cols;
     unsigned char *cells;
+    uint32_t *zbalene;
+    signed char *vstupy;
 } Map;
 
+typedef enum
+{
+    PAMAT_BUNKY,
+    PAMAT_VSTUPY,
+    PAMAT_PARSER,
+    PAMAT_RIESIC,
+    POCET_PAMATI,
+} PAMAT;
+
+atomic_llong pamat_teraz[POCET_PAMATI];
+atomic_llong pamat_spicka[POCET_PAMATI];
+atomic_llong najvacsia_mapa;
+bool nizka_spotreba_pamate = false;
+
 typedef enum
 {
     DOPRAVA,
@@ -44,6 +95,81 @@ typedef enum
 int horna_dolna_hranica(int r, int c);
 void binarny_rozklad(int cislo, int binarny_rozklad[3]);
 bool is_border(Map *map, int r, int c, int border);
+int start_direction(Map *map, int r, int c, int leftright);
+void vytvor_tabulku_vstupov(Map *map);
+int pocet_okrajovych(Map *map);
+
+/**
+ * @brief Zapocita alokaciu alebo uvolnenie pamate do kategorie pre --mem-report
+ * 
+ * @param kategoria kategoria pamate
+ * @param zmena pocet bajtov, kladny pri alokacii a zaporny pri uvolneni
+*/
+void zapocitaj_pamat(PAMAT kategoria, long long zmena)
+{
+    long long teraz = atomic_fetch_add(&pamat_teraz[kategoria], zmena) + zmena;
+    long long spicka = atomic_load(&pamat_spicka[kategoria]);
+    while(teraz > spicka && !atomic_compare_exchange_weak(&pamat_spicka[kategoria], &spicka, teraz))
+        ;
+}
+
+/**
+ * @brief Vypise spicky pamate jednotlivych kategorii na stderr, vola sa cez atexit
+*/
+void vypis_spotrebu_pamate(void)
+{
+    fflush(stdout);
+    long long policka = atomic_load(&najvacsia_mapa);
+    fprintf(stderr, "mem-report: cells %lld B, entrance table %lld B, parser buffers %lld B, solver scratch %lld B (peak), "
+            "maze %lld cells = %lld B at 3 bits per cell\n", atomic_load(&pamat_spicka[PAMAT_BUNKY]), atomic_load(&pamat_spicka[PAMAT_VSTUPY]),
+            atomic_load(&pamat_spicka[PAMAT_PARSER]), atomic_load(&pamat_spicka[PAMAT_RIESIC]), policka, (3 * policka + 7) / 8);
+}
+
+/**
+ * @brief Precita hodnotu policka, v obycajnej aj zbalenej mape
+ * 
+ * Zbalena mapa ma 3 bity na policko, BUNIEK_V_SLOVE policok v jednom 32-bitovom slove
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * @param index index policka
+ * 
+ * @return Vracia cislo policka 0 az 7
+*/
+unsigned char bunka(Map *map, int index)
+{
+    if(map->zbalene != NULL)
+        return (map->zbalene[index / BUNIEK_V_SLOVE] >> (3 * (index % BUNIEK_V_SLOVE))) & 7;
+    return map->cells[index];
+}
+
+/**
+ * @brief Zapise hodnotu policka, v obycajnej aj zbalenej mape
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * @param index index policka
+ * @param hodnota cislo policka 0 az 7
+*/
+void nastav_bunku(Map *map, int index, unsigned char hodnota)
+{
+    if(map->zbalene != NULL)
+    {
+        int posun = 3 * (index % BUNIEK_V_SLOVE);
+        uint32_t *slovo = &map->zbalene[index / BUNIEK_V_SLOVE];
+        *slovo = (*slovo & ~((uint32_t)7 << posun)) | ((uint32_t)hodnota << posun);
+    }
+    else
+        map->cells[index] = hodnota;
+}
+
+/**
+ * @brief Velkost pola policok mapy v bajtoch
+*/
+size_t velkost_buniek(Map *map)
+{
+    if(map->zbalene != NULL)
+        return ((size_t)map->rows * map->cols + BUNIEK_V_SLOVE - 1) / BUNIEK_V_SLOVE * sizeof(uint32_t);
+    return (size_t)map->rows * map->cols;
+}
 
 /**
  * @brief Uvolnenie dynamickej pamate
@@ -53,7 +179,12 @@ bool is_border(Map *map, int r, int c, int border);
  */
 void free_map(Map *mapa_bludiska)
 {
+    zapocitaj_pamat(PAMAT_BUNKY, -(long long)(sizeof(Map) + velkost_buniek(mapa_bludiska)));
+    if(mapa_bludiska->vstupy != NULL)
+        zapocitaj_pamat(PAMAT_VSTUPY, -2LL * pocet_okrajovych(mapa_bludiska));
     free(mapa_bludiska->cells);
+    free(mapa_bludiska->zbalene);
+    free(mapa_bludiska->vstupy);
     free(mapa_bludiska);
 }
 
@@ -63,81 +194,117 @@ void free_map(Map *mapa_bludiska)
  * @param rad Pocet riadkov mapy
  * @param stlpec Pocet stlpcov mapy
  * 
- * @return Vracia ukazatel na strukturu Map s inicializovanou mapou 
+ * @return Vracia ukazatel na strukturu Map s inicializovanou mapou alebo NULL, ak pamat nestaci
  */
 Map *inicialize_map(int rad, int stlpec)
 {
     Map *mapa_bludiska = (Map*)malloc(sizeof(Map));
+    if(mapa_bludiska == NULL)
+        return NULL;
     mapa_bludiska->rows = rad;
     mapa_bludiska->cols = stlpec;
-    mapa_bludiska->cells = (unsigned char*)malloc(rad * stlpec * sizeof(unsigned char));
+    mapa_bludiska->cells = (unsigned char*)malloc((size_t)rad * stlpec * sizeof(unsigned char));
+    mapa_bludiska->zbalene = NULL;
+    mapa_bludiska->vstupy = NULL;
+    if(mapa_bludiska->cells == NULL)
+    {
+        free(mapa_bludiska);
+        return NULL;
+    }
     
+    zapocitaj_pamat(PAMAT_BUNKY, sizeof(Map) + velkost_buniek(mapa_bludiska));
     return mapa_bludiska;
 }
 
 /**
- * @brief Ziskanie mapy zo suboru
+ * @brief Inicializacia zbalenej mapy, 3 bity na policko namiesto celeho bajtu
+ * 
+ * @param rad Pocet riadkov mapy
+ * @param stlpec Pocet stlpcov mapy
+ * 
+ * @return Vracia ukazatel na strukturu Map so zbalenymi polickami alebo NULL, ak pamat nestaci
+ */
+Map *inicialize_zbalenu_mapu(int rad, int stlpec)
+{
+    Map *mapa_bludiska = (Map*)malloc(sizeof(Map));
+    if(mapa_bludiska == NULL)
+        return NULL;
+    mapa_bludiska->rows = rad;
+    mapa_bludiska->cols = stlpec;
+    mapa_bludiska->cells = NULL;
+    mapa_bludiska->zbalene = (uint32_t*)calloc(((size_t)rad * stlpec + BUNIEK_V_SLOVE - 1) / BUNIEK_V_SLOVE, sizeof(uint32_t));
+    mapa_bludiska->vstupy = NULL;
+    if(mapa_bludiska->zbalene == NULL)
+    {
+        free(mapa_bludiska);
+        return NULL;
+    }
+
+    zapocitaj_pamat(PAMAT_BUNKY, sizeof(Map) + velkost_buniek(mapa_bludiska));
+    return mapa_bludiska;
+}
+
+/**
+ * @brief Nacitanie mapy z otvoreneho suboru
  * 
  * Vo funkcii inicializujeme mapu a testuje sa jej validita
  * Zapiseme ziskane udaje do struktury Map->cells
+ * Subor moze byt aj v pamati (fmemopen), funkcia ho nezatvara
  * 
- * @param bludisko ukazatel na subor s bludiskom
- * @return mapu bludiska v strukture Map*
+ * @param subor_bludiska otvoreny subor s bludiskom
+ * @param zbalena ci sa maju policka ulozit zbalene po 3 bitoch
+ * @return mapu bludiska v strukture Map* alebo NULL, ak mapa nie je platna
  */
-Map *get_map(char *bludisko)
+Map *nacitaj_mapu_v_tvare(FILE *subor_bludiska, bool zbalena)
 {
-    FILE *subor_bludiska = fopen(bludisko, "r");
-    if(subor_bludiska == NULL)
+    int pocet_radov, pocet_stlpcov;
+    if(fscanf(subor_bludiska, "%d %d", &pocet_radov, &pocet_stlpcov) != 2 || pocet_radov < 1 || pocet_stlpcov < 1 || pocet_radov > INT_MAX / pocet_stlpcov)
     {
         fprintf(stderr, "Invalid\n");
         return NULL;
     }
 
-    int pocet_radov, pocet_stlpcov;
-    if(fscanf(subor_bludiska, "%d %d", &pocet_radov, &pocet_stlpcov) != 2 || pocet_radov < 1 || pocet_stlpcov < 1)
+    Map *mapa_bludiska = zbalena ? inicialize_zbalenu_mapu(pocet_radov, pocet_stlpcov) : inicialize_map(pocet_radov, pocet_stlpcov);
+    if(mapa_bludiska == NULL)
     {
         fprintf(stderr, "Invalid\n");
-        fclose(subor_bludiska);
         return NULL;
     }
-
-    Map *mapa_bludiska = inicialize_map(pocet_radov, pocet_stlpcov);
     for(int i = 0; i < pocet_radov * pocet_stlpcov; i++)
     {
-        if(fscanf(subor_bludiska, "%hhd", &mapa_bludiska->cells[i]) != 1)
+        unsigned char hodnota;
+        if(fscanf(subor_bludiska, "%hhd", &hodnota) != 1)
         {
-            fclose(subor_bludiska);
             free_map(mapa_bludiska);
             return NULL;
         }
         
-        int cislo_zo_subora = mapa_bludiska->cells[i];
+        int cislo_zo_subora = hodnota;
         int binarny_rozklad_cisla[3];
         binarny_rozklad(cislo_zo_subora, binarny_rozklad_cisla);
         if(cislo_zo_subora < 0 || cislo_zo_subora > 7)
         {
-            fclose(subor_bludiska);
             free_map(mapa_bludiska);
             return NULL;
         }
+        nastav_bunku(mapa_bludiska, i, hodnota);
         
         int momentalny_rad = i / pocet_stlpcov;
         int momentalny_stlpec = i % pocet_stlpcov;
         if(momentalny_stlpec > 0)
         {
-            int cislo_zo_subora_nalavo = mapa_bludiska->cells[i - 1];
+            int cislo_zo_subora_nalavo = bunka(mapa_bludiska, i - 1);
             int binarny_rozklad_cisla_nalavo[3];
             binarny_rozklad(cislo_zo_subora_nalavo, binarny_rozklad_cisla_nalavo);
             if(binarny_rozklad_cisla[0] != binarny_rozklad_cisla_nalavo[1])
             {
-                fclose(subor_bludiska);
                 free_map(mapa_bludiska);
                 return NULL;
             }
         }
         if(momentalny_rad > 0)
         {
-            int cislo_zo_subora_hore = mapa_bludiska->cells[i - pocet_stlpcov];
+            int cislo_zo_subora_hore = bunka(mapa_bludiska, i - pocet_stlpcov);
             int rad_cisla_hore = (i - pocet_stlpcov) / pocet_stlpcov; 
             int stlpec_cisla_hore = (i - pocet_stlpcov) % pocet_stlpcov;
             int binarny_rozklad_cisla_hore[3];
@@ -146,14 +313,58 @@ Map *get_map(char *bludisko)
             {
                 if(binarny_rozklad_cisla[2] != binarny_rozklad_cisla_hore[2])
                 {
-                    fclose(subor_bludiska);
                     free_map(mapa_bludiska);
                     return NULL;
                 }
             }
         }
     }
+    // do hlasenia sa pocitaju iba uspesne nacitane mapy
+    long long najvacsia = atomic_load(&najvacsia_mapa);
+    while((long long)pocet_radov * pocet_stlpcov > najvacsia && !atomic_compare_exchange_weak(&najvacsia_mapa, &najvacsia, (long long)pocet_radov * pocet_stlpcov))
+        ;
+    vytvor_tabulku_vstupov(mapa_bludiska);
+    return mapa_bludiska;
+}
+
+/**
+ * @brief Nacitanie mapy z otvoreneho suboru do obycajnej mapy, bajt na policko
+ */
+Map *nacitaj_mapu(FILE *subor_bludiska)
+{
+    return nacitaj_mapu_v_tvare(subor_bludiska, false);
+}
+
+/**
+ * @brief Ziskanie mapy zo suboru
+ * 
+ * @param bludisko ukazatel na subor s bludiskom
+ * @return mapu bludiska v strukture Map*
+ */
+Map *get_map(char *bludisko)
+{
+    FILE *subor_bludiska = fopen(bludisko, "r");
+    if(subor_bludiska == NULL)
+    {
+        fprintf(stderr, "Invalid\n");
+        return NULL;
+    }
+
+    // vlastny buffer, aby bola pamat parsera znama pre --mem-report
+    char *buffer = (char*)malloc(VELKOST_BUFFERA_PARSERA);
+    if(buffer != NULL && setvbuf(subor_bludiska, buffer, _IOFBF, VELKOST_BUFFERA_PARSERA) == 0)
+        zapocitaj_pamat(PAMAT_PARSER, VELKOST_BUFFERA_PARSERA);
+    else
+    {
+        free(buffer);
+        buffer = NULL;
+    }
+
+    Map *mapa_bludiska = nacitaj_mapu_v_tvare(subor_bludiska, nizka_spotreba_pamate);
     fclose(subor_bludiska);
+    if(buffer != NULL)
+        zapocitaj_pamat(PAMAT_PARSER, -VELKOST_BUFFERA_PARSERA);
+    free(buffer);
     return mapa_bludiska;
 }
 
@@ -178,6 +389,8 @@ void binarny_rozklad(int cislo, int binarny_rozklad[3])
  * @brief Zisti, ci sa na policku nachadza konkretna stena
  * 
  * pomocou binarneho rozkladu funkcia zisti pravdivostnu hodnotu steny
+ * Obycajna mapa sa cita priamo a funkcia je inline, aby sa aj s vetvou pre zbalenu mapu
+ * vkladala do krokov algoritmov
  * 
  * @param map ukazatel na mapu bludiska v strukture Map
  * @param r riadok policka
@@ -186,10 +399,10 @@ void binarny_rozklad(int cislo, int binarny_rozklad[3])
  * 
  * @return pravdivostnu hodnotu konkretnej hranice
 */
-bool is_border(Map *map, int r, int c, int border)
+inline bool is_border(Map *map, int r, int c, int border)
 {
     int index = r * map->cols + c;
-    int cislo_zo_subora = map->cells[index];
+    int cislo_zo_subora = map->cells != NULL ? map->cells[index] : bunka(map, index);
     int binarny_rozklad_cisla[3];
     binarny_rozklad(cislo_zo_subora, binarny_rozklad_cisla);
 
@@ -437,7 +650,7 @@ int start_border_left(Map *map, int r, int c)
 */
 int start_border(Map *map, int r, int c, int leftright)
 {
-    int border;
+    int border = -1;
     if(leftright == RIGHT_PATH)
     {
         border = start_border_right(map, r, c);
@@ -498,367 +711,2539 @@ int start_direction(Map *map, int r, int c, int leftright)
 }
 
 /**
- * @brief Algrotimy na riesenie bludiska podla pravej/lavej ruky
+ * @brief Zisti poradove cislo okrajoveho policka
  * 
- * Oba algoritmy sa pozeraju na smer, odkial prisli a na otocenie policka
- * Rukou sa vzdy drzi najblizsej steny a prinutuje opisanu cestu von, pricom sa pozera aj na smer odkial sa prislo
+ * Okrajove policka su cislovane postupne: horny rad, dolny rad, lavy stlpec a pravy stlpec bez rohov
  * 
- * @param map ukazatel na strukturu mapy
- * @param r rad, v ktorom sa momentalne nachadzame
- * @param c stlpec, v ktorom sa momentalne nachadzame
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * @param r riadok, v ktorom sa nachadza policko
+ * @param c stlpec, v ktorom sa nachadza policko
+ * 
+ * @return Vracia index do tabulky vstupov alebo -1, ak policko nie je na okraji
 */
-void rpath_algoritmus(Map *map, int r, int c)
+int okrajovy_index(Map *map, int r, int c)
 {
-    int aktualny_smer = start_direction(map, r, c, RIGHT_PATH); 
-    if(aktualny_smer == -1)
-    {
-        fprintf(stdout, "Invalid Entrance\n");
+    if(r < 0 || c < 0 || r >= map->rows || c >= map->cols)
+        return -1;
+    if(r == 0)
+        return c;
+    if(r == map->rows - 1)
+        return map->cols + c;
+    if(c == 0)
+        return 2 * map->cols + (r - 1);
+    if(c == map->cols - 1)
+        return 2 * map->cols + (map->rows - 2) + (r - 1);
+    return -1;
+}
+
+/**
+ * @brief Zisti pocet okrajovych policok, teda velkost tabulky vstupov
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * 
+ * @return Vracia pocet okrajovych policok
+*/
+int pocet_okrajovych(Map *map)
+{
+    if(map->rows == 1)
+        return map->cols;
+    if(map->cols == 1)
+        return 2 + (map->rows - 2);
+    return 2 * map->cols + 2 * (map->rows - 2);
+}
+
+/**
+ * @brief Predpocita pociatocny smer oboch algoritmov pre kazde okrajove policko
+ * 
+ * Tabulka sa vytvori raz pri nacitani mapy, pre kazde okrajove policko su v nej dva smery,
+ * na indexe LEFT_PATH a RIGHT_PATH, -1 znamena neplatny vstup
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+*/
+void vytvor_tabulku_vstupov(Map *map)
+{
+    int pocet = pocet_okrajovych(map);
+    signed char *vstupy = (signed char*)malloc(2 * pocet * sizeof(signed char));
+    if(vstupy == NULL)
         return;
+    zapocitaj_pamat(PAMAT_VSTUPY, 2 * pocet * sizeof(signed char));
+
+    for(int r = 0; r < map->rows; r++)
+    {
+        bool okrajovy_rad = (r == 0 || r == map->rows - 1);
+        for(int c = 0; c < map->cols; c += (okrajovy_rad || map->cols == 1) ? 1 : map->cols - 1)
+        {
+            int index = okrajovy_index(map, r, c);
+            vstupy[2 * index + LEFT_PATH] = start_direction(map, r, c, LEFT_PATH);
+            vstupy[2 * index + RIGHT_PATH] = start_direction(map, r, c, RIGHT_PATH);
+        }
     }
+    map->vstupy = vstupy;
+}
 
-    while(r > -1 && c > -1 && r < map->rows && c < map->cols)
+/**
+ * @brief Zisti pociatocny smer algoritmu pomocou tabulky vstupov
+ * 
+ * Ak mapa tabulku nema (napr. mapa vytvorena mimo get_map), smer sa vypocita cez start_direction
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * @param r riadok, v ktorom sa nachadza policko
+ * @param c stlpec, v ktorom sa nachadza policko
+ * @param leftright pravidlo pravej/lavej ruky
+ * 
+ * @return Vracia smer, akym sa ma vydat algoritmus, alebo -1 pri neplatnom vstupe
+*/
+int entrance_direction(Map *map, int r, int c, int leftright)
+{
+    if(map->vstupy == NULL)
+        return start_direction(map, r, c, leftright);
+
+    int index = okrajovy_index(map, r, c);
+    if(index == -1)
+        return -1;
+    return map->vstupy[2 * index + leftright];
+}
+
+/**
+ * @brief Vypise vsetky okrajove policka a ich pociatocne smery
+ * 
+ * Kazdy riadok ma tvar "R,C Valid|Invalid lpath:SMER rpath:SMER", pri neplatnom smere sa vypise "-"
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * @param vystup subor, do ktoreho sa vstupy vypisuju
+*/
+void vypis_vstupy(Map *map, FILE *vystup)
+{
+    const char *nazvy_smerov[] = {"right", "up", "left", "down"};
+
+    for(int r = 0; r < map->rows; r++)
     {
-        printf("%d,%d\n", r + 1, c + 1);
-        int horna_or_dolna_hranica = horna_dolna_hranica(r, c);
-        if(aktualny_smer == DOPRAVA)
+        bool okrajovy_rad = (r == 0 || r == map->rows - 1);
+        for(int c = 0; c < map->cols; c += (okrajovy_rad || map->cols == 1) ? 1 : map->cols - 1)
         {
-            if(horna_or_dolna_hranica == HORNA_HRANICA)
+            int lavy_smer = entrance_direction(map, r, c, LEFT_PATH);
+            int pravy_smer = entrance_direction(map, r, c, RIGHT_PATH);
+            fprintf(vystup, "%d,%d %s lpath:%s rpath:%s\n", r + 1, c + 1, (lavy_smer != -1 || pravy_smer != -1) ? "Valid" : "Invalid",
+                   lavy_smer != -1 ? nazvy_smerov[lavy_smer] : "-", pravy_smer != -1 ? nazvy_smerov[pravy_smer] : "-");
+        }
+    }
+}
+
+/**
+ * @brief Jeden krok algoritmov pravej/lavej ruky
+ * 
+ * Funkcie sa pozru na smer, odkial sa prislo a na otocenie policka, posunu r a c na dalsie policko
+ * Nic nevypisuju, aby sa dali pouzit aj mimo vypisu cesty
+ * 
+ * @param map ukazatel na strukturu mapy
+ * @param ukazatel_r ukazatel na rad, v ktorom sa momentalne nachadzame
+ * @param ukazatel_c ukazatel na stlpec, v ktorom sa momentalne nachadzame
+ * @param aktualny_smer smer, ktorym sa algoritmus momentalne pohybuje
+ * 
+ * @return Vracia novy smer
+*/
+int rpath_krok(Map *map, int *ukazatel_r, int *ukazatel_c, int aktualny_smer)
+{
+    int r = *ukazatel_r;
+    int c = *ukazatel_c;
+    int horna_or_dolna_hranica = horna_dolna_hranica(r, c);
+    if(aktualny_smer == DOPRAVA)
+    {
+        if(horna_or_dolna_hranica == HORNA_HRANICA)
+        {
+            if(is_border(map, r, c, PRAVA_HRANICA) == false)
             {
-                if(is_border(map, r, c, PRAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOPRAVA;
-                    c++;
-                }
-                else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, HORNA_HRANICA) == false)
-                {
-                    aktualny_smer = HORE;
-                    r--;
-                }
-                else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, HORNA_HRANICA) == true)
-                {
-                    aktualny_smer = DOLAVA;
-                    c--;
-                }
+                aktualny_smer = DOPRAVA;
+                c++;
             }
-            else if(horna_or_dolna_hranica == DOLNA_HRANICA)
+            else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, HORNA_HRANICA) == false)
             {
-                if(is_border(map, r, c, DOLNA_HRANICA) == false)
-                {
-                    aktualny_smer = DOLE;
-                    r++;
-                }
-                else if(is_border(map, r, c, DOLNA_HRANICA) == true && is_border(map, r, c, PRAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOPRAVA;
-                    c++;
-                }
-                else if(is_border(map, r, c, DOLNA_HRANICA) == true && is_border(map, r, c, PRAVA_HRANICA) == true)
-                {
-                    aktualny_smer = DOLAVA;
-                    c--;
-                }
+                aktualny_smer = HORE;
+                r--;
+            }
+            else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, HORNA_HRANICA) == true)
+            {
+                aktualny_smer = DOLAVA;
+                c--;
             }
         }
-        else if(aktualny_smer == HORE)
+        else if(horna_or_dolna_hranica == DOLNA_HRANICA)
         {
-            if(horna_or_dolna_hranica == DOLNA_HRANICA)
+            if(is_border(map, r, c, DOLNA_HRANICA) == false)
             {
-                if(is_border(map, r, c, PRAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOPRAVA;
-                    c++;
-                }
-                else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, LAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOLAVA;
-                    c--;
-                }
-                else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, LAVA_HRANICA) == true)
-                {
-                    aktualny_smer = DOLE;
-                    r++;
-                }
+                aktualny_smer = DOLE;
+                r++;
             }
-            else if(horna_or_dolna_hranica == HORNA_HRANICA)
+            else if(is_border(map, r, c, DOLNA_HRANICA) == true && is_border(map, r, c, PRAVA_HRANICA) == false)
             {
-                if(is_border(map, r, c, PRAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOPRAVA;
-                    c++;
-                }
-                else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, HORNA_HRANICA) == false)
-                {
-                    aktualny_smer = HORE;
-                    r--;
-                }
-                else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, HORNA_HRANICA) == true)
-                {
-                    aktualny_smer = DOLAVA;
-                    c--;
-                }
+                aktualny_smer = DOPRAVA;
+                c++;
+            }
+            else if(is_border(map, r, c, DOLNA_HRANICA) == true && is_border(map, r, c, PRAVA_HRANICA) == true)
+            {
+                aktualny_smer = DOLAVA;
+                c--;
             }
         }
-        else if(aktualny_smer == DOLE)
+    }
+    else if(aktualny_smer == HORE)
+    {
+        if(horna_or_dolna_hranica == DOLNA_HRANICA)
         {
-            if(horna_or_dolna_hranica == HORNA_HRANICA)
+            if(is_border(map, r, c, PRAVA_HRANICA) == false)
             {
-                if(is_border(map, r, c, LAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOLAVA;
-                    c--;
-                }
-                else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, PRAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOPRAVA;
-                    c++;
-                }
-                else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, PRAVA_HRANICA) == true)
-                {
-                    aktualny_smer = HORE;
-                    r--;
-                }
+                aktualny_smer = DOPRAVA;
+                c++;
             }
-            else if(horna_or_dolna_hranica == DOLNA_HRANICA)
+            else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, LAVA_HRANICA) == false)
             {
-                if(is_border(map, r, c, LAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOPRAVA;
-                    c--;
-                }
-                else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, DOLNA_HRANICA) == false)
-                {
-                    aktualny_smer = DOLE;
-                    r++;
-                }
-                else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, DOLNA_HRANICA) == true)
-                {
-                    aktualny_smer = DOLAVA;
-                    c++;
-                }
+                aktualny_smer = DOLAVA;
+                c--;
+            }
+            else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, LAVA_HRANICA) == true)
+            {
+                aktualny_smer = DOLE;
+                r++;
             }
         }
-        else if(aktualny_smer == DOLAVA)
+        else if(horna_or_dolna_hranica == HORNA_HRANICA)
         {
-            if(horna_or_dolna_hranica == HORNA_HRANICA)
+            if(is_border(map, r, c, PRAVA_HRANICA) == false)
             {
-                if(is_border(map, r, c, HORNA_HRANICA) == false)
-                {
-                    aktualny_smer = HORE;
-                    r--;
-                }
-                else if(is_border(map, r, c, HORNA_HRANICA) == true && is_border(map, r, c, LAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOLAVA;
-                    c--;
-                }
-                else if(is_border(map, r, c, HORNA_HRANICA) == true && is_border(map, r, c, LAVA_HRANICA) == true)
-                {
-                    aktualny_smer = DOPRAVA;
-                    c++;
-                }
+                aktualny_smer = DOPRAVA;
+                c++;
             }
-            else if(horna_or_dolna_hranica == DOLNA_HRANICA)
+            else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, HORNA_HRANICA) == false)
             {
-               if(is_border(map, r, c, LAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOLAVA;
-                    c--;
-                }
-                else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, DOLNA_HRANICA) == false)
-                {
-                    aktualny_smer = DOLE;
-                    r++;
-                }
-                else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, DOLNA_HRANICA) == true)
-                {
-                    aktualny_smer = DOPRAVA;
-                    c++;
-                } 
+                aktualny_smer = HORE;
+                r--;
+            }
+            else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, HORNA_HRANICA) == true)
+            {
+                aktualny_smer = DOLAVA;
+                c--;
             }
         }
     }
-}
-
-void lpath_algoritmus(Map *map, int r, int c)
-{
-    int aktualny_smer = start_direction(map, r, c, LEFT_PATH);
-    if(aktualny_smer == -1)
-    {
-        fprintf(stdout, "Invalid Entrance\n");
-        return;
-    }
-    
-    while(r > -1 && c > -1 && r < map->rows && c < map->cols)
+    else if(aktualny_smer == DOLE)
     {
-        printf("%d,%d\n", r + 1, c + 1);
-        int horna_or_dolna_hranica = horna_dolna_hranica(r, c);
-        if(aktualny_smer == DOPRAVA)
+        if(horna_or_dolna_hranica == HORNA_HRANICA)
         {
-            if(horna_or_dolna_hranica == HORNA_HRANICA)
+            if(is_border(map, r, c, LAVA_HRANICA) == false)
             {
-                if(is_border(map, r, c, HORNA_HRANICA) == false)
-                {
-                    aktualny_smer = HORE;
-                    r--;
-                }
-                else if(is_border(map, r, c, HORNA_HRANICA) == true && is_border(map, r, c, PRAVA_HRANICA) == false)
+                aktualny_smer = DOLAVA;
+                c--;
+            }
+            else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, PRAVA_HRANICA) == false)
+            {
+                aktualny_smer = DOPRAVA;
+                c++;
+            }
+            else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, PRAVA_HRANICA) == true)
+            {
+                aktualny_smer = HORE;
+                r--;
+            }
+        }
+        else if(horna_or_dolna_hranica == DOLNA_HRANICA)
+        {
+            if(is_border(map, r, c, LAVA_HRANICA) == false)
+            {
+                aktualny_smer = DOPRAVA;
+                c--;
+            }
+            else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, DOLNA_HRANICA) == false)
+            {
+                aktualny_smer = DOLE;
+                r++;
+            }
+            else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, DOLNA_HRANICA) == true)
+            {
+                aktualny_smer = DOLAVA;
+                c++;
+            }
+        }
+    }
+    else if(aktualny_smer == DOLAVA)
+    {
+        if(horna_or_dolna_hranica == HORNA_HRANICA)
+        {
+            if(is_border(map, r, c, HORNA_HRANICA) == false)
+            {
+                aktualny_smer = HORE;
+                r--;
+            }
+            else if(is_border(map, r, c, HORNA_HRANICA) == true && is_border(map, r, c, LAVA_HRANICA) == false)
+            {
+                aktualny_smer = DOLAVA;
+                c--;
+            }
+            else if(is_border(map, r, c, HORNA_HRANICA) == true && is_border(map, r, c, LAVA_HRANICA) == true)
+            {
+                aktualny_smer = DOPRAVA;
+                c++;
+            }
+        }
+        else if(horna_or_dolna_hranica == DOLNA_HRANICA)
+        {
+           if(is_border(map, r, c, LAVA_HRANICA) == false)
+            {
+                aktualny_smer = DOLAVA;
+                c--;
+            }
+            else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, DOLNA_HRANICA) == false)
+            {
+                aktualny_smer = DOLE;
+                r++;
+            }
+            else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, DOLNA_HRANICA) == true)
+            {
+                aktualny_smer = DOPRAVA;
+                c++;
+            } 
+        }
+    }
+    *ukazatel_r = r;
+    *ukazatel_c = c;
+    return aktualny_smer;
+}
+
+int lpath_krok(Map *map, int *ukazatel_r, int *ukazatel_c, int aktualny_smer)
+{
+    int r = *ukazatel_r;
+    int c = *ukazatel_c;
+    int horna_or_dolna_hranica = horna_dolna_hranica(r, c);
+    if(aktualny_smer == DOPRAVA)
+    {
+        if(horna_or_dolna_hranica == HORNA_HRANICA)
+        {
+            if(is_border(map, r, c, HORNA_HRANICA) == false)
+            {
+                aktualny_smer = HORE;
+                r--;
+            }
+            else if(is_border(map, r, c, HORNA_HRANICA) == true && is_border(map, r, c, PRAVA_HRANICA) == false)
+            {
+                aktualny_smer = DOPRAVA;
+                c++;
+            }
+            else if(is_border(map, r, c, HORNA_HRANICA) == true && is_border(map, r, c, PRAVA_HRANICA) == true)
+            {
+                aktualny_smer = DOLAVA;
+                c--;
+            }
+        }
+        else if(horna_or_dolna_hranica == DOLNA_HRANICA)
+        {
+            if(is_border(map, r, c, PRAVA_HRANICA) == false)
+            {
+                aktualny_smer = DOPRAVA;
+                c++;
+            }
+            else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, DOLNA_HRANICA) == false)
+            {
+                aktualny_smer = DOLE;
+                r++;
+            }
+            else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, DOLNA_HRANICA) == true)
+            {
+                aktualny_smer = DOLAVA;
+                c--;
+            }
+        }
+    }
+    else if(aktualny_smer == HORE)
+    {
+        if(horna_or_dolna_hranica == DOLNA_HRANICA)
+        {
+            if(is_border(map, r, c, LAVA_HRANICA) == false)
+            {
+                aktualny_smer = DOLAVA;
+                c--;
+            }
+            else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, PRAVA_HRANICA) == false)
+            {
+                aktualny_smer = DOPRAVA;
+                c++;
+            }
+            else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, PRAVA_HRANICA) == true)
+            {
+                aktualny_smer = DOLE;
+                r++;
+            }
+        }
+        else if(horna_or_dolna_hranica == HORNA_HRANICA)
+        {
+            if(is_border(map, r, c, LAVA_HRANICA) == false)
+            {
+                aktualny_smer = DOLAVA;
+                c--;
+            }
+            else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, HORNA_HRANICA) == false)
+            {
+                aktualny_smer = HORE;
+                r--;
+            }
+            else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, HORNA_HRANICA) == true)
+            {
+                aktualny_smer = DOPRAVA;
+                c++;
+            }
+        }
+    }
+    else if(aktualny_smer == DOLE)
+    {
+        if(horna_or_dolna_hranica == HORNA_HRANICA)
+        {
+            if(is_border(map, r, c, PRAVA_HRANICA) == false)
+            {
+                aktualny_smer = DOPRAVA;
+                c++;
+            }
+            else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, LAVA_HRANICA) == false)
+            {
+                aktualny_smer = DOLAVA;
+                c--;
+            }
+            else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, LAVA_HRANICA) == true)
+            {
+                aktualny_smer = HORE;
+                r--;
+            }
+        }
+        else if(horna_or_dolna_hranica == DOLNA_HRANICA)
+        {
+            if(is_border(map, r, c, PRAVA_HRANICA) == false)
+            {
+                aktualny_smer = DOPRAVA;
+                c++;
+            }
+            else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, DOLNA_HRANICA) == false)
+            {
+                aktualny_smer = DOLE;
+                r++;
+            }
+            else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, DOLNA_HRANICA) == true)
+            {
+                aktualny_smer = DOLAVA;
+                c--;
+            }
+        }
+    }
+    else if(aktualny_smer == DOLAVA)
+    {
+        if(horna_or_dolna_hranica == HORNA_HRANICA)
+        {
+            if(is_border(map, r, c, LAVA_HRANICA) == false)
+            {
+                aktualny_smer = DOLAVA;
+                c--;
+            }
+            else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, HORNA_HRANICA) == false)
+            {
+                aktualny_smer = HORE;
+                r--;
+            }
+            else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, HORNA_HRANICA) == true)
+            {
+                aktualny_smer = DOPRAVA;
+                c++;
+            }
+        }
+        else if(horna_or_dolna_hranica == DOLNA_HRANICA)
+        {
+            if(is_border(map, r, c, DOLNA_HRANICA) == false)
+            {
+                aktualny_smer = DOLE;
+                r++;
+            }
+            else if(is_border(map, r, c, DOLNA_HRANICA) == true && is_border(map, r, c, LAVA_HRANICA) == false)
+            {
+                aktualny_smer = DOLAVA;
+                c--;
+            }
+            else if(is_border(map, r, c, DOLNA_HRANICA) == true && is_border(map, r, c, LAVA_HRANICA) == true)
+            {
+                aktualny_smer = DOPRAVA;
+                c++;
+            }
+        }
+    }
+    *ukazatel_r = r;
+    *ukazatel_c = c;
+    return aktualny_smer;
+}
+
+/**
+ * @brief Spravi jeden krok podla pravej alebo lavej ruky
+ *
+ * @param leftright RIGHT_PATH pre rpath_krok, inak lpath_krok
+ *
+ * @return Vracia novy smer
+*/
+int krok(Map *map, int *ukazatel_r, int *ukazatel_c, int aktualny_smer, int leftright)
+{
+    if(leftright == RIGHT_PATH)
+        return rpath_krok(map, ukazatel_r, ukazatel_c, aktualny_smer);
+    return lpath_krok(map, ukazatel_r, ukazatel_c, aktualny_smer);
+}
+
+/**
+ * @brief Algrotimy na riesenie bludiska podla pravej/lavej ruky
+ * 
+ * Oba algoritmy sa pozeraju na smer, odkial prisli a na otocenie policka
+ * Rukou sa vzdy drzi najblizsej steny a prinutuje opisanu cestu von, pricom sa pozera aj na smer odkial sa prislo
+ * 
+ * @param map ukazatel na strukturu mapy
+ * @param r rad, v ktorom sa momentalne nachadzame
+ * @param c stlpec, v ktorom sa momentalne nachadzame
+ * @param vystup subor, do ktoreho sa cesta vypisuje
+*/
+void rpath_algoritmus(Map *map, int r, int c, FILE *vystup)
+{
+    int aktualny_smer = entrance_direction(map, r, c, RIGHT_PATH);
+    if(aktualny_smer == -1)
+    {
+        fprintf(vystup, "Invalid Entrance\n");
+        return;
+    }
+
+    while(r > -1 && c > -1 && r < map->rows && c < map->cols)
+    {
+        fprintf(vystup, "%d,%d\n", r + 1, c + 1);
+        aktualny_smer = rpath_krok(map, &r, &c, aktualny_smer);
+    }
+}
+
+void lpath_algoritmus(Map *map, int r, int c, FILE *vystup)
+{
+    int aktualny_smer = entrance_direction(map, r, c, LEFT_PATH);
+    if(aktualny_smer == -1)
+    {
+        fprintf(vystup, "Invalid Entrance\n");
+        return;
+    }
+    
+    while(r > -1 && c > -1 && r < map->rows && c < map->cols)
+    {
+        fprintf(vystup, "%d,%d\n", r + 1, c + 1);
+        aktualny_smer = lpath_krok(map, &r, &c, aktualny_smer);
+    }
+}
+
+#define CHECKPOINT_KROKY (1LL << 24)
+#define MAX_CESTA 4096
+
+/**
+ * @brief Stav prechodu bludiskom, ktory sa da ulozit a neskor v prechode pokracovat
+ * 
+ * r, c a aktualny_smer su policko, ktore sa ma vypisat ako dalsie, a smer, ktorym sa na neho prislo.
+ * kroky je pocet uz vypisanych policok a posun pocet bajtov vystupu, ktore su urcite zapisane.
+*/
+typedef struct
+{
+    int leftright;
+    int r;
+    int c;
+    int aktualny_smer;
+    long long kroky;
+    long long posun;
+    char subor[MAX_CESTA];
+} StavPrechodu;
+
+/**
+ * @brief Ulozi stav prechodu do suboru
+ * 
+ * Stav sa zapise do docasneho suboru, ktory sa potom premenuje, takze aj po preruseni
+ * zostane na disku bud stary, alebo novy stav, nikdy nie polovica
+ * 
+ * @param cesta cesta k suboru so stavom
+ * @param stav ukazatel na stav prechodu
+ * 
+ * @return Vracia true, ak sa stav podarilo ulozit
+*/
+bool uloz_checkpoint(const char *cesta, StavPrechodu *stav)
+{
+    char docasna_cesta[MAX_CESTA + 8];
+    snprintf(docasna_cesta, sizeof(docasna_cesta), "%s.tmp", cesta);
+    FILE *subor = fopen(docasna_cesta, "w");
+    if(subor == NULL)
+        return false;
+
+    fprintf(subor, "MAZE-CHECKPOINT 1\n%d %d %d %d %lld %lld\n%s\n", stav->leftright, stav->r, stav->c,
+            stav->aktualny_smer, stav->kroky, stav->posun, stav->subor);
+    bool zapisane = fflush(subor) == 0 && fsync(fileno(subor)) == 0;
+    zapisane = fclose(subor) == 0 && zapisane;
+    return zapisane && rename(docasna_cesta, cesta) == 0;
+}
+
+/**
+ * @brief Nacita stav prechodu ulozeny funkciou uloz_checkpoint
+ * 
+ * @param cesta cesta k suboru so stavom
+ * @param stav ukazatel, kam sa stav nacita
+ * 
+ * @return Vracia true, ak je subor platny
+*/
+bool nacitaj_checkpoint(const char *cesta, StavPrechodu *stav)
+{
+    FILE *subor = fopen(cesta, "r");
+    if(subor == NULL)
+        return false;
+
+    int verzia;
+    bool platny = fscanf(subor, "MAZE-CHECKPOINT %d %d %d %d %d %lld %lld ", &verzia, &stav->leftright, &stav->r, &stav->c,
+                         &stav->aktualny_smer, &stav->kroky, &stav->posun) == 7 && verzia == 1 &&
+                  fgets(stav->subor, sizeof(stav->subor), subor) != NULL;
+    fclose(subor);
+    if(!platny)
+        return false;
+
+    stav->subor[strcspn(stav->subor, "\n")] = '\0';
+    return (stav->leftright == LEFT_PATH || stav->leftright == RIGHT_PATH) && stav->aktualny_smer >= DOPRAVA &&
+           stav->aktualny_smer <= DOLE && stav->kroky >= 0 && stav->posun >= 0;
+}
+
+/**
+ * @brief Pokracuje v prechode bludiskom zo stavu a pravidelne stav uklada
+ * 
+ * Kazdych `interval` krokov sa vystup vyprazdni a stav sa ulozi do suboru checkpoint.
+ * Ked prechod vyjde z bludiska, subor so stavom sa zmaze.
+ * 
+ * @param map ukazatel na strukturu mapy
+ * @param stav ukazatel na stav prechodu, priebezne sa aktualizuje
+ * @param checkpoint cesta k suboru so stavom
+ * @param interval pocet krokov medzi dvomi ulozeniami stavu
+ * @param max_krokov po kolkych krokoch sa ma prechod zastavit, -1 znamena az po vychod
+ * @param vystup subor, do ktoreho sa cesta vypisuje
+ * 
+ * @return Vracia 0, ak prechod skoncil, 1 ak sa zastavil po max_krokov, -1 ak sa stav nepodarilo ulozit
+ * a -2, ak zlyhal zapis do vystupu. Vtedy sa stav neulozi, lebo posun vystupu uz nesedi
+*/
+int prechod_s_checkpointom(Map *map, StavPrechodu *stav, const char *checkpoint, long long interval, long long max_krokov, FILE *vystup)
+{
+    int r = stav->r, c = stav->c, aktualny_smer = stav->aktualny_smer;
+    long long zaciatok = stav->kroky;
+    while(r > -1 && c > -1 && r < map->rows && c < map->cols)
+    {
+        if(stav->kroky > zaciatok && stav->kroky % interval == 0)
+        {
+            stav->r = r;
+            stav->c = c;
+            stav->aktualny_smer = aktualny_smer;
+            if(fflush(vystup) != 0)
+                return -2;
+            if(!uloz_checkpoint(checkpoint, stav))
+                return -1;
+        }
+        if(max_krokov != -1 && stav->kroky - zaciatok >= max_krokov)
+            return 1;
+
+        int zapisane = fprintf(vystup, "%d,%d\n", r + 1, c + 1);
+        if(zapisane < 0 || ferror(vystup))
+            return -2;
+        stav->posun += zapisane;
+        stav->kroky++;
+        aktualny_smer = krok(map, &r, &c, aktualny_smer, stav->leftright);
+    }
+    stav->r = r;
+    stav->c = c;
+    stav->aktualny_smer = aktualny_smer;
+    remove(checkpoint);
+    return 0;
+}
+
+/**
+ * @brief Zisti, kolko krokov ma byt medzi dvomi ulozeniami stavu
+ * 
+ * Da sa nastavit premennou prostredia MAZE_CHECKPOINT_STEPS, inak CHECKPOINT_KROKY
+ * 
+ * @return Vracia interval ukladania
+*/
+long long interval_checkpointu(void)
+{
+    char *nastavenie = getenv("MAZE_CHECKPOINT_STEPS");
+    if(nastavenie != NULL && atoll(nastavenie) > 0)
+        return atoll(nastavenie);
+    return CHECKPOINT_KROKY;
+}
+
+/**
+ * @brief Zacne prechod bludiskom na standardny vystup a pravidelne uklada jeho stav
+ * 
+ * Ak je standardny vystup obycajny subor, posun vystupu sa pocita od jeho aktualneho konca
+ * 
+ * @param map ukazatel na strukturu mapy
+ * @param leftright pravidlo pravej/lavej ruky
+ * @param r riadok vstupu
+ * @param c stlpec vstupu
+ * @param subor cesta k suboru s bludiskom, do stavu sa ulozi absolutna, aby sa dal obnovit z ineho adresara
+ * @param checkpoint cesta k suboru so stavom
+ * 
+ * @return Vracia 0 pri uspechu, inak 1
+*/
+int zacni_prechod(Map *map, int leftright, int r, int c, const char *subor, const char *checkpoint)
+{
+    int aktualny_smer = entrance_direction(map, r, c, leftright);
+    if(aktualny_smer == -1)
+    {
+        printf("Invalid Entrance\n");
+        return 0;
+    }
+    char *absolutna_cesta = realpath(subor, NULL);
+    if(absolutna_cesta == NULL)
+    {
+        fprintf(stderr, "Error, cannot resolve maze path %s\n", subor);
+        return 1;
+    }
+    if(strlen(absolutna_cesta) >= MAX_CESTA)
+    {
+        fprintf(stderr, "Error, maze path is too long for a checkpoint\n");
+        free(absolutna_cesta);
+        return 1;
+    }
+
+    StavPrechodu stav = {leftright, r, c, aktualny_smer, 0, 0, ""};
+    strcpy(stav.subor, absolutna_cesta);
+    free(absolutna_cesta);
+    struct stat informacie;
+    fflush(stdout);
+    if(fstat(fileno(stdout), &informacie) == 0 && S_ISREG(informacie.st_mode))
+        stav.posun = lseek(fileno(stdout), 0, SEEK_END);
+    if(stav.posun < 0)
+        stav.posun = 0;
+
+    int vysledok = prechod_s_checkpointom(map, &stav, checkpoint, interval_checkpointu(), -1, stdout);
+    if(vysledok == -1)
+        fprintf(stderr, "Error, cannot write checkpoint %s\n", checkpoint);
+    else if(vysledok == -2)
+        fprintf(stderr, "Error, cannot write output\n");
+    return vysledok < 0 ? 1 : 0;
+}
+
+/**
+ * @brief Pokracuje v prechode ulozenom v subore so stavom
+ * 
+ * Ak je standardny vystup obycajny subor, skrati sa na ulozeny posun, aby sa policka
+ * vypisane po poslednom ulozeni stavu nevypisali dvakrat. Ak je kratsi ako posun, prechod
+ * sa nespusti a subor so stavom zostane nezmeneny
+ * 
+ * @param checkpoint cesta k suboru so stavom
+ * 
+ * @return Vracia 0 pri uspechu, inak 1
+*/
+int obnov_prechod(const char *checkpoint)
+{
+    StavPrechodu stav;
+    if(!nacitaj_checkpoint(checkpoint, &stav))
+    {
+        fprintf(stderr, "Error, invalid checkpoint %s\n", checkpoint);
+        return 1;
+    }
+    Map *mapa = get_map(stav.subor);
+    if(mapa == NULL)
+    {
+        fprintf(stderr, "Invalid\n");
+        return 1;
+    }
+
+    struct stat informacie;
+    fflush(stdout);
+    if(fstat(fileno(stdout), &informacie) == 0 && S_ISREG(informacie.st_mode))
+    {
+        // vystup otvoreny cez > je uz prazdny, skratenie by ho doplnilo nulovymi bajtmi
+        if(informacie.st_size < stav.posun)
+        {
+            fprintf(stderr, "Error, output is shorter than the checkpoint, append it to the original file with >>\n");
+            free_map(mapa);
+            return 1;
+        }
+        if(ftruncate(fileno(stdout), stav.posun) != 0 || lseek(fileno(stdout), stav.posun, SEEK_SET) == -1)
+        {
+            fprintf(stderr, "Error, cannot truncate output to the checkpoint\n");
+            free_map(mapa);
+            return 1;
+        }
+    }
+
+    int vysledok = prechod_s_checkpointom(mapa, &stav, checkpoint, interval_checkpointu(), -1, stdout);
+    if(vysledok == -1)
+        fprintf(stderr, "Error, cannot write checkpoint %s\n", checkpoint);
+    else if(vysledok == -2)
+        fprintf(stderr, "Error, cannot write output\n");
+    free_map(mapa);
+    return vysledok < 0 ? 1 : 0;
+}
+
+/**
+ * @brief Zisti, na ktore susedne policka sa da z policka prejst
+ * 
+ * Do susedov sa nepocita prechod von z bludiska, iba policka vo vnutri mapy
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * @param index index policka v Map->cells
+ * @param susedia pole, do ktoreho sa ulozia indexy susednych policok
+ * 
+ * @return Vracia pocet susednych policok, na ktore sa da prejst
+*/
+int otvoreni_susedia(Map *map, int index, int susedia[3])
+{
+    int r = index / map->cols;
+    int c = index % map->cols;
+    int pocet = 0;
+    if(c > 0 && is_border(map, r, c, LAVA_HRANICA) == false)
+        susedia[pocet++] = index - 1;
+    if(c < map->cols - 1 && is_border(map, r, c, PRAVA_HRANICA) == false)
+        susedia[pocet++] = index + 1;
+    if(horna_dolna_hranica(r, c) == HORNA_HRANICA)
+    {
+        if(r > 0 && is_border(map, r, c, HORNA_HRANICA) == false)
+            susedia[pocet++] = index - map->cols;
+    }
+    else if(r < map->rows - 1 && is_border(map, r, c, DOLNA_HRANICA) == false)
+        susedia[pocet++] = index + map->cols;
+    return pocet;
+}
+
+typedef struct
+{
+    int f;
+    int g;
+    int uzol;
+} PolozkaHaldy;
+
+typedef struct
+{
+    PolozkaHaldy *polozky;
+    int pocet;
+    int kapacita;
+} Halda;
+
+/**
+ * @brief Porovna dve polozky haldy, mensie f ide skor, pri rovnosti vacsie g
+ * 
+ * @return Vracia true, ak ma polozka a ist z haldy skor ako polozka b
+*/
+bool skor_v_halde(PolozkaHaldy a, PolozkaHaldy b)
+{
+    return a.f < b.f || (a.f == b.f && a.g > b.g);
+}
+
+/**
+ * @brief Vlozi polozku do binarnej haldy ulozenej v jednom poli
+ * 
+ * @param halda ukazatel na haldu
+ * @param polozka polozka, ktora sa ma vlozit
+ * 
+ * @return Vracia false, ak sa nepodarilo zvacsit pole haldy
+*/
+bool halda_vloz(Halda *halda, PolozkaHaldy polozka)
+{
+    if(halda->pocet == halda->kapacita)
+    {
+        int nova_kapacita = halda->kapacita ? 2 * halda->kapacita : 256;
+        PolozkaHaldy *vacsie = (PolozkaHaldy*)realloc(halda->polozky, nova_kapacita * sizeof(PolozkaHaldy));
+        if(vacsie == NULL)
+            return false;
+        zapocitaj_pamat(PAMAT_RIESIC, (long long)(nova_kapacita - halda->kapacita) * sizeof(PolozkaHaldy));
+        halda->polozky = vacsie;
+        halda->kapacita = nova_kapacita;
+    }
+
+    int i = halda->pocet++;
+    while(i > 0 && skor_v_halde(polozka, halda->polozky[(i - 1) / 2]))
+    {
+        halda->polozky[i] = halda->polozky[(i - 1) / 2];
+        i = (i - 1) / 2;
+    }
+    halda->polozky[i] = polozka;
+    return true;
+}
+
+/**
+ * @brief Vyberie z haldy polozku s najmensim f
+ * 
+ * @param halda ukazatel na neprazdnu haldu
+ * 
+ * @return Vracia vybratu polozku
+*/
+PolozkaHaldy halda_vyber(Halda *halda)
+{
+    PolozkaHaldy vrchol = halda->polozky[0];
+    PolozkaHaldy posledna = halda->polozky[--halda->pocet];
+    int i = 0;
+    while(2 * i + 1 < halda->pocet)
+    {
+        int dieta = 2 * i + 1;
+        if(dieta + 1 < halda->pocet && skor_v_halde(halda->polozky[dieta + 1], halda->polozky[dieta]))
+            dieta++;
+        if(!skor_v_halde(halda->polozky[dieta], posledna))
+            break;
+        halda->polozky[i] = halda->polozky[dieta];
+        i = dieta;
+    }
+    halda->polozky[i] = posledna;
+    return vrchol;
+}
+
+void free_halda(Halda *halda)
+{
+    zapocitaj_pamat(PAMAT_RIESIC, -(long long)halda->kapacita * sizeof(PolozkaHaldy));
+    free(halda->polozky);
+}
+
+/**
+ * @brief Dolny odhad poctu krokov medzi dvomi polickami trojuholnikovej mriezky
+ * 
+ * Kazdy krok zmeni rad alebo stlpec o 1. Dole sa da ist iba z policka s dolnou hranicou
+ * a hore iba z policka s hornou hranicou (podla horna_dolna_hranica), takze medzi dvomi
+ * zvislymi krokmi rovnakym smerom musi byt aspon jeden vodorovny krok.
+ * Kazdy krok navyse meni paritu r + c, takze dlzka cesty ma paritu rozdielu parit.
+ * 
+ * @param r1 riadok prveho policka
+ * @param c1 stlpec prveho policka
+ * @param r2 riadok druheho policka
+ * @param c2 stlpec druheho policka
+ * 
+ * @return Vracia pocet krokov, ktory skutocnu vzdialenost nikdy neprekroci
+*/
+int heuristika_trojuholnikov(int r1, int c1, int r2, int c2)
+{
+    int zvisle = abs(r2 - r1);
+    int vodorovne = abs(c2 - c1);
+    int minimum_vodorovnych = 0;
+    if(zvisle > 0)
+    {
+        int smer_zaciatku = r2 > r1 ? DOLNA_HRANICA : HORNA_HRANICA;
+        int smer_konca = r2 > r1 ? HORNA_HRANICA : DOLNA_HRANICA;
+        minimum_vodorovnych = zvisle - 1 + (horna_dolna_hranica(r1, c1) != smer_zaciatku) + (horna_dolna_hranica(r2, c2) != smer_konca);
+    }
+    int odhad = zvisle + (vodorovne > minimum_vodorovnych ? vodorovne : minimum_vodorovnych);
+    if((odhad + r1 + c1 + r2 + c2) % 2 != 0)
+        odhad++;
+    return odhad;
+}
+
+/**
+ * @brief Najde najkratsiu cestu medzi dvomi polickami algoritmom A*
+ * 
+ * Vzdialenosti a predchodcovia su v plochych poliach indexovanych ako Map->cells.
+ * Polozka haldy, ktorej g je horsie ako aktualne g policka, sa preskoci, takze policko
+ * sa moze expandovat znova, ak sa k nemu najde kratsia cesta.
+ * Bez heuristiky sa algoritmus sprava ako prehladavanie do sirky.
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * @param start index pociatocneho policka
+ * @param ciel index ciela
+ * @param s_heuristikou ci sa ma pouzit heuristika_trojuholnikov
+ * @param dlzka ukazatel, kam sa ulozi pocet policok cesty
+ * @param expandovane ukazatel, kam sa ulozi pocet expandovanych policok
+ * 
+ * @return Vracia pole indexov policok od startu po ciel alebo NULL, ak cesta neexistuje
+*/
+int *astar_cesta(Map *map, int start, int ciel, bool s_heuristikou, int *dlzka, long *expandovane)
+{
+    int pocet_policok = map->rows * map->cols;
+    int ciel_r = ciel / map->cols, ciel_c = ciel % map->cols;
+    int *g = (int*)malloc(pocet_policok * sizeof(int));
+    int *predchodca = (int*)malloc(pocet_policok * sizeof(int));
+    Halda halda = {NULL, 0, 0};
+    int *cesta = NULL;
+    *dlzka = 0;
+    *expandovane = 0;
+    if(g == NULL || predchodca == NULL)
+    {
+        free(g);
+        free(predchodca);
+        return NULL;
+    }
+    zapocitaj_pamat(PAMAT_RIESIC, 2LL * pocet_policok * sizeof(int));
+    for(int i = 0; i < pocet_policok; i++)
+        g[i] = INT_MAX;
+
+    g[start] = 0;
+    predchodca[start] = -1;
+    int h = s_heuristikou ? heuristika_trojuholnikov(start / map->cols, start % map->cols, ciel_r, ciel_c) : 0;
+    bool v_poriadku = halda_vloz(&halda, (PolozkaHaldy){h, 0, start});
+    while(v_poriadku && halda.pocet > 0)
+    {
+        PolozkaHaldy polozka = halda_vyber(&halda);
+        if(polozka.g > g[polozka.uzol])
+            continue;
+        (*expandovane)++;
+        if(polozka.uzol == ciel)
+            break;
+
+        int susedia[3];
+        int pocet_susedov = otvoreni_susedia(map, polozka.uzol, susedia);
+        for(int i = 0; i < pocet_susedov; i++)
+        {
+            int sused = susedia[i];
+            if(polozka.g + 1 >= g[sused])
+                continue;
+            g[sused] = polozka.g + 1;
+            predchodca[sused] = polozka.uzol;
+            h = s_heuristikou ? heuristika_trojuholnikov(sused / map->cols, sused % map->cols, ciel_r, ciel_c) : 0;
+            v_poriadku = halda_vloz(&halda, (PolozkaHaldy){g[sused] + h, g[sused], sused}) && v_poriadku;
+        }
+    }
+
+    if(v_poriadku && g[ciel] != INT_MAX)
+    {
+        *dlzka = g[ciel] + 1;
+        cesta = (int*)malloc(*dlzka * sizeof(int));
+        for(int i = *dlzka - 1, uzol = ciel; cesta != NULL && i >= 0; i--, uzol = predchodca[uzol])
+            cesta[i] = uzol;
+    }
+    zapocitaj_pamat(PAMAT_RIESIC, -2LL * pocet_policok * sizeof(int));
+    free(g);
+    free(predchodca);
+    free_halda(&halda);
+    return cesta;
+}
+
+#define BITY_KUSA 14
+
+/**
+ * @brief Riedka mapa navstivenych policok, 2 bity na policko
+ * 
+ * Policka su rozdelene na kusy po 2^BITY_KUSA, kus sa alokuje az pri prvom zapise,
+ * takze nenavstivene casti bludiska nezaberaju pamat. 0 znamena nenavstivene policko,
+ * inak smer k predchodcovi: 1 vlavo, 2 vpravo, 3 hore alebo dole podla horna_dolna_hranica.
+*/
+typedef struct
+{
+    int pocet_kusov;
+    uint8_t **kusy;
+} RiedkaMapa;
+
+bool riedka_inicializuj(RiedkaMapa *riedka, int pocet_policok)
+{
+    riedka->pocet_kusov = (pocet_policok >> BITY_KUSA) + 1;
+    riedka->kusy = (uint8_t**)calloc(riedka->pocet_kusov, sizeof(uint8_t*));
+    if(riedka->kusy == NULL)
+        return false;
+    zapocitaj_pamat(PAMAT_RIESIC, (long long)riedka->pocet_kusov * sizeof(uint8_t*));
+    return true;
+}
+
+unsigned riedka_citaj(RiedkaMapa *riedka, int index)
+{
+    uint8_t *kus = riedka->kusy[index >> BITY_KUSA];
+    if(kus == NULL)
+        return 0;
+    int v_kuse = index & ((1 << BITY_KUSA) - 1);
+    return (kus[v_kuse / 4] >> (2 * (v_kuse % 4))) & 3;
+}
+
+/**
+ * @brief Zapise 2-bitovu hodnotu policka do riedkej mapy, podla potreby alokuje kus
+ * 
+ * @return Vracia false, ak sa kus nepodarilo alokovat
+*/
+bool riedka_zapis(RiedkaMapa *riedka, int index, unsigned hodnota)
+{
+    uint8_t **kus = &riedka->kusy[index >> BITY_KUSA];
+    if(*kus == NULL)
+    {
+        *kus = (uint8_t*)calloc((1 << BITY_KUSA) / 4, sizeof(uint8_t));
+        if(*kus == NULL)
+            return false;
+        zapocitaj_pamat(PAMAT_RIESIC, (1 << BITY_KUSA) / 4);
+    }
+    int v_kuse = index & ((1 << BITY_KUSA) - 1);
+    (*kus)[v_kuse / 4] = ((*kus)[v_kuse / 4] & ~(3 << (2 * (v_kuse % 4)))) | (hodnota << (2 * (v_kuse % 4)));
+    return true;
+}
+
+void free_riedka(RiedkaMapa *riedka)
+{
+    for(int i = 0; i < riedka->pocet_kusov; i++)
+    {
+        if(riedka->kusy[i] != NULL)
+            zapocitaj_pamat(PAMAT_RIESIC, -(1 << BITY_KUSA) / 4);
+        free(riedka->kusy[i]);
+    }
+    zapocitaj_pamat(PAMAT_RIESIC, -(long long)riedka->pocet_kusov * sizeof(uint8_t*));
+    free(riedka->kusy);
+}
+
+/**
+ * @brief Najde najkratsiu cestu medzi dvomi polickami s malou spotrebou pamate a rovno ju vypise
+ * 
+ * Prehladava sa do sirky od ciela. Kazde navstivene policko si v riedkej mape pamata smer,
+ * ktorym je o krok blizsie k cielu, takze po dosiahnuti startu sa cesta vypise od startu
+ * po ciel bez ukladania celej cesty. Kruhova fronta rastie iba podla sirky prehladavania.
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map, moze byt zbalena
+ * @param start index pociatocneho policka
+ * @param ciel index ciela
+ * @param expandovane ukazatel, kam sa ulozi pocet expandovanych policok
+ * @param vystup subor, do ktoreho sa cesta vypise
+ * 
+ * @return Vracia 1, ak sa cesta nasla, 0 ak neexistuje, -1 ak nestacila pamat
+*/
+int cesta_s_malou_pamatou(Map *map, int start, int ciel, long *expandovane, FILE *vystup)
+{
+    RiedkaMapa navstivene;
+    *expandovane = 0;
+    if(!riedka_inicializuj(&navstivene, map->rows * map->cols))
+        return -1;
+
+    int kapacita = 256, zaciatok = 0, pocet = 0;
+    int *fronta = (int*)malloc(kapacita * sizeof(int));
+    bool v_poriadku = fronta != NULL && riedka_zapis(&navstivene, ciel, 3);
+    if(fronta != NULL)
+        zapocitaj_pamat(PAMAT_RIESIC, kapacita * sizeof(int));
+    if(v_poriadku)
+        fronta[pocet++] = ciel;
+
+    bool najdena = start == ciel;
+    while(v_poriadku && !najdena && pocet > 0)
+    {
+        int policko = fronta[zaciatok];
+        zaciatok = (zaciatok + 1) % kapacita;
+        pocet--;
+        (*expandovane)++;
+
+        int susedia[3];
+        int pocet_susedov = otvoreni_susedia(map, policko, susedia);
+        for(int i = 0; v_poriadku && i < pocet_susedov; i++)
+        {
+            int sused = susedia[i];
+            if(riedka_citaj(&navstivene, sused) != 0)
+                continue;
+            v_poriadku = riedka_zapis(&navstivene, sused, policko == sused - 1 ? 1 : policko == sused + 1 ? 2 : 3);
+            if(sused == start)
+                najdena = true;
+
+            if(pocet == kapacita)
+            {
+                int *vacsia = (int*)malloc(2 * kapacita * sizeof(int));
+                if(vacsia == NULL)
                 {
-                    aktualny_smer = DOPRAVA;
-                    c++;
+                    v_poriadku = false;
+                    break;
                 }
-                else if(is_border(map, r, c, HORNA_HRANICA) == true && is_border(map, r, c, PRAVA_HRANICA) == true)
+                for(int j = 0; j < pocet; j++)
+                    vacsia[j] = fronta[(zaciatok + j) % kapacita];
+                zapocitaj_pamat(PAMAT_RIESIC, kapacita * sizeof(int));
+                free(fronta);
+                fronta = vacsia;
+                zaciatok = 0;
+                kapacita *= 2;
+            }
+            fronta[(zaciatok + pocet++) % kapacita] = sused;
+        }
+    }
+
+    for(int policko = start; v_poriadku && najdena; )
+    {
+        fprintf(vystup, "%d,%d\n", policko / map->cols + 1, policko % map->cols + 1);
+        if(policko == ciel)
+            break;
+        unsigned smer = riedka_citaj(&navstivene, policko);
+        if(smer == 1)
+            policko--;
+        else if(smer == 2)
+            policko++;
+        else
+            policko += horna_dolna_hranica(policko / map->cols, policko % map->cols) == HORNA_HRANICA ? -map->cols : map->cols;
+    }
+
+    if(fronta != NULL)
+        zapocitaj_pamat(PAMAT_RIESIC, -(long long)kapacita * sizeof(int));
+    free(fronta);
+    free_riedka(&navstivene);
+    if(!v_poriadku)
+        return -1;
+    return najdena ? 1 : 0;
+}
+
+/**
+ * @brief Zisti, ci sa da z policka prejst priamo von z bludiska
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * @param index index policka v Map->cells
+ * 
+ * @return Vracia true, ak ma policko otvorenu stenu na okraji mapy
+*/
+bool vedie_von(Map *map, int index)
+{
+    int r = index / map->cols;
+    int c = index % map->cols;
+    if(c == 0 && is_border(map, r, c, LAVA_HRANICA) == false)
+        return true;
+    if(c == map->cols - 1 && is_border(map, r, c, PRAVA_HRANICA) == false)
+        return true;
+    if(horna_dolna_hranica(r, c) == HORNA_HRANICA)
+        return r == 0 && is_border(map, r, c, HORNA_HRANICA) == false;
+    return r == map->rows - 1 && is_border(map, r, c, DOLNA_HRANICA) == false;
+}
+
+/**
+ * @brief Najde vsetky slepe ulicky v bludisku
+ * 
+ * Policko s jedinou otvorenou stenou, ktore nevedie von z bludiska, je slepe. Ked sa oznaci,
+ * susedovi ubudne jedna otvorena stena, a ak mu zostala jedina, prida sa do zoznamu na spracovanie.
+ * Tak sa postupne oznacia cele slepe chodby, vratane vetiev, ktore sa do nich vlievaju.
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * @param pocet_mrtvych ukazatel, kam sa ulozi pocet oznacenych policok
+ * 
+ * @return Vracia bitovu masku slepych policok (bit i % 8 v bajte i / 8) alebo NULL pri chybe
+*/
+unsigned char *najdi_slepe_ulicky(Map *map, int *pocet_mrtvych)
+{
+    int pocet_policok = map->rows * map->cols;
+    unsigned char *mrtve = (unsigned char*)calloc(pocet_policok / 8 + 1, sizeof(unsigned char));
+    unsigned char *stupne = (unsigned char*)malloc(pocet_policok * sizeof(unsigned char));
+    int *zoznam = (int*)malloc(pocet_policok * sizeof(int));
+    *pocet_mrtvych = 0;
+    if(mrtve == NULL || stupne == NULL || zoznam == NULL)
+    {
+        free(mrtve);
+        free(stupne);
+        free(zoznam);
+        return NULL;
+    }
+    long long pamat = (pocet_policok / 8 + 1) + (long long)pocet_policok * (sizeof(unsigned char) + sizeof(int));
+    zapocitaj_pamat(PAMAT_RIESIC, pamat);
+
+    int velkost_zoznamu = 0;
+    int susedia[3];
+    for(int i = 0; i < pocet_policok; i++)
+    {
+        stupne[i] = otvoreni_susedia(map, i, susedia);
+        if(stupne[i] == 1 && !vedie_von(map, i))
+            zoznam[velkost_zoznamu++] = i;
+    }
+
+    while(velkost_zoznamu > 0)
+    {
+        int policko = zoznam[--velkost_zoznamu];
+        mrtve[policko / 8] |= 1 << (policko % 8);
+        (*pocet_mrtvych)++;
+
+        int pocet_susedov = otvoreni_susedia(map, policko, susedia);
+        for(int i = 0; i < pocet_susedov; i++)
+        {
+            int sused = susedia[i];
+            if(mrtve[sused / 8] & (1 << (sused % 8)))
+                continue;
+            if(--stupne[sused] == 1 && !vedie_von(map, sused))
+                zoznam[velkost_zoznamu++] = sused;
+        }
+    }
+    zapocitaj_pamat(PAMAT_RIESIC, -pamat);
+    free(stupne);
+    free(zoznam);
+    return mrtve;
+}
+
+/**
+ * @brief Zamuruje slepe policka, aby ich ziadny algoritmus nenavstivil
+ * 
+ * Slepe policko dostane vsetky tri steny a jeho zivy sused stenu, ktoru s nim zdiela,
+ * takze mapa zostane platna pre get_map
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * @param mrtve bitova maska z najdi_slepe_ulicky
+*/
+void zamuruj_slepe_ulicky(Map *map, unsigned char *mrtve)
+{
+    for(int i = 0; i < map->rows * map->cols; i++)
+    {
+        if(!(mrtve[i / 8] & (1 << (i % 8))))
+            continue;
+
+        int susedia[3];
+        int pocet_susedov = otvoreni_susedia(map, i, susedia);
+        for(int j = 0; j < pocet_susedov; j++)
+        {
+            int sused = susedia[j];
+            if(sused == i - 1)
+                nastav_bunku(map, sused, bunka(map, sused) | 2);
+            else if(sused == i + 1)
+                nastav_bunku(map, sused, bunka(map, sused) | 1);
+            else
+                nastav_bunku(map, sused, bunka(map, sused) | 4);
+        }
+        nastav_bunku(map, i, 7);
+    }
+}
+
+/**
+ * @brief Postavi stenu na policku aj na susednom policku, s ktorym ju zdiela
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * @param r riadok policka
+ * @param c stlpec policka
+ * @param hranica hranica, na ktoru sa ma stena postavit
+*/
+void postav_stenu(Map *map, int r, int c, int hranica)
+{
+    int sused_r = r, sused_c = c, stena, sused_hranica;
+    switch (hranica)
+    {
+    case LAVA_HRANICA:
+        stena = 1;
+        sused_c = c - 1;
+        sused_hranica = 2;
+        break;
+    case PRAVA_HRANICA:
+        stena = 2;
+        sused_c = c + 1;
+        sused_hranica = 1;
+        break;
+    default:
+        stena = 4;
+        sused_r = horna_dolna_hranica(r, c) == HORNA_HRANICA ? r - 1 : r + 1;
+        sused_hranica = 4;
+        break;
+    }
+    nastav_bunku(map, r * map->cols + c, bunka(map, r * map->cols + c) | stena);
+    if(sused_r > -1 && sused_c > -1 && sused_r < map->rows && sused_c < map->cols)
+        nastav_bunku(map, sused_r * map->cols + sused_c, bunka(map, sused_r * map->cols + sused_c) | sused_hranica);
+}
+
+/**
+ * @brief Zapise mapu v rovnakom formate, aky cita get_map
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * @param subor otvoreny subor, do ktoreho sa mapa zapise
+*/
+void zapis_mapu(Map *map, FILE *subor)
+{
+    fprintf(subor, "%d %d\n", map->rows, map->cols);
+    for(int r = 0; r < map->rows; r++)
+    {
+        for(int c = 0; c < map->cols; c++)
+            fprintf(subor, c == 0 ? "%d" : " %d", bunka(map, r * map->cols + c));
+        fprintf(subor, "\n");
+    }
+}
+
+/**
+ * @brief Ulozi mapu do suboru
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * @param cesta cesta k vystupnemu suboru
+ * 
+ * @return Vracia true, ak sa subor podarilo zapisat
+*/
+bool uloz_mapu(Map *map, const char *cesta)
+{
+    FILE *subor = fopen(cesta, "w");
+    if(subor == NULL)
+        return false;
+
+    zapis_mapu(map, subor);
+    return fclose(subor) == 0;
+}
+
+/**
+ * @brief Graf krizovatiek, do ktoreho sa zlisuju chodby bludiska
+ * 
+ * Uzly su policka, z ktorych sa neda pokracovat jedinym smerom (krizovatky a slepe konce)
+ * a policka veduce von z bludiska. Hrana je cela chodba medzi dvomi uzlami, vaha je pocet krokov.
+ * Hrany su v tvare CSR: hrany uzla u su na indexoch zaciatky[u] az zaciatky[u + 1] - 1.
+ * Policka vo vnutri chodby hrany e su v poli cesty na indexoch cesty_zaciatky[e] az cesty_zaciatky[e + 1] - 1.
+*/
+typedef struct
+{
+    int pocet_uzlov;
+    int pocet_hran;
+    int *uzly;
+    int *uzol_policka;
+    int *zaciatky;
+    int *ciele;
+    int *vahy;
+    int *cesty_zaciatky;
+    int *cesty;
+    long long pamat;
+} GrafKrizovatiek;
+
+void free_graf(GrafKrizovatiek *graf)
+{
+    if(graf == NULL)
+        return;
+    zapocitaj_pamat(PAMAT_RIESIC, -graf->pamat);
+    free(graf->uzly);
+    free(graf->uzol_policka);
+    free(graf->zaciatky);
+    free(graf->ciele);
+    free(graf->vahy);
+    free(graf->cesty_zaciatky);
+    free(graf->cesty);
+    free(graf);
+}
+
+/**
+ * @brief Zlisuje chodby bludiska do grafu krizovatiek
+ * 
+ * Z kazdeho uzla sa kazdym otvorenym smerom prejde chodba az po dalsi uzol a zapise sa ako hrana.
+ * Kruhove chodby bez jedineho uzla sa zo ziadneho uzla nedaju dosiahnut, preto v grafe nie su.
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * 
+ * @return Vracia ukazatel na graf alebo NULL pri chybe
+*/
+GrafKrizovatiek *vytvor_graf_krizovatiek(Map *map)
+{
+    int pocet_policok = map->rows * map->cols;
+    GrafKrizovatiek *graf = (GrafKrizovatiek*)calloc(1, sizeof(GrafKrizovatiek));
+    if(graf == NULL)
+        return NULL;
+    graf->uzol_policka = (int*)malloc(pocet_policok * sizeof(int));
+    if(graf->uzol_policka == NULL)
+    {
+        free_graf(graf);
+        return NULL;
+    }
+
+    int susedia[3];
+    for(int i = 0; i < pocet_policok; i++)
+    {
+        int pocet_susedov = otvoreni_susedia(map, i, susedia);
+        if(pocet_susedov != 2 || vedie_von(map, i))
+        {
+            graf->uzol_policka[i] = graf->pocet_uzlov++;
+            graf->pocet_hran += pocet_susedov;
+        }
+        else
+            graf->uzol_policka[i] = -1;
+    }
+
+    int kapacita_ciest = 64;
+    graf->uzly = (int*)malloc((graf->pocet_uzlov + 1) * sizeof(int));
+    graf->zaciatky = (int*)malloc((graf->pocet_uzlov + 1) * sizeof(int));
+    graf->ciele = (int*)malloc((graf->pocet_hran + 1) * sizeof(int));
+    graf->vahy = (int*)malloc((graf->pocet_hran + 1) * sizeof(int));
+    graf->cesty_zaciatky = (int*)malloc((graf->pocet_hran + 1) * sizeof(int));
+    graf->cesty = (int*)malloc(kapacita_ciest * sizeof(int));
+    if(graf->uzly == NULL || graf->zaciatky == NULL || graf->ciele == NULL || graf->vahy == NULL || graf->cesty_zaciatky == NULL || graf->cesty == NULL)
+    {
+        free_graf(graf);
+        return NULL;
+    }
+
+    int hrana = 0, dlzka_ciest = 0;
+    for(int i = 0; i < pocet_policok; i++)
+    {
+        int uzol = graf->uzol_policka[i];
+        if(uzol == -1)
+            continue;
+        graf->uzly[uzol] = i;
+        graf->zaciatky[uzol] = hrana;
+
+        int pocet_susedov = otvoreni_susedia(map, i, susedia);
+        for(int j = 0; j < pocet_susedov; j++, hrana++)
+        {
+            graf->cesty_zaciatky[hrana] = dlzka_ciest;
+            int predosle = i, aktualne = susedia[j], vaha = 1;
+            while(graf->uzol_policka[aktualne] == -1)
+            {
+                if(dlzka_ciest == kapacita_ciest)
                 {
-                    aktualny_smer = DOLAVA;
-                    c--;
+                    kapacita_ciest *= 2;
+                    int *vacsie = (int*)realloc(graf->cesty, kapacita_ciest * sizeof(int));
+                    if(vacsie == NULL)
+                    {
+                        free_graf(graf);
+                        return NULL;
+                    }
+                    graf->cesty = vacsie;
                 }
+                graf->cesty[dlzka_ciest++] = aktualne;
+
+                int dalsie_susedia[3];
+                otvoreni_susedia(map, aktualne, dalsie_susedia);
+                int dalsie = dalsie_susedia[0] != predosle ? dalsie_susedia[0] : dalsie_susedia[1];
+                predosle = aktualne;
+                aktualne = dalsie;
+                vaha++;
+            }
+            graf->ciele[hrana] = graf->uzol_policka[aktualne];
+            graf->vahy[hrana] = vaha;
+        }
+    }
+    graf->zaciatky[graf->pocet_uzlov] = hrana;
+    graf->cesty_zaciatky[hrana] = dlzka_ciest;
+    graf->pamat = (long long)(pocet_policok + 2 * (graf->pocet_uzlov + 1) + 3 * (graf->pocet_hran + 1) + kapacita_ciest) * sizeof(int);
+    zapocitaj_pamat(PAMAT_RIESIC, graf->pamat);
+    return graf;
+}
+
+/**
+ * @brief Najde najkratsiu cestu zo vstupu k najblizsiemu inemu vychodu
+ * 
+ * Dijkstrov algoritmus bezi nad grafom krizovatiek, cela cesta sa potom posklada z policok ulozenych pri hranach
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * @param graf graf krizovatiek vytvoreny z mapy
+ * @param start index vstupneho policka, musi viest von z bludiska
+ * @param dlzka ukazatel, kam sa ulozi pocet policok cesty
+ * 
+ * @return Vracia pole indexov policok od vstupu po vychod alebo NULL, ak ziadny iny vychod nie je dosiahnutelny
+*/
+int *najkratsia_cesta_von(Map *map, GrafKrizovatiek *graf, int start, int *dlzka)
+{
+    int start_uzol = graf->uzol_policka[start];
+    int *vzdialenost = (int*)malloc(graf->pocet_uzlov * sizeof(int));
+    int *predosla_hrana = (int*)malloc(graf->pocet_uzlov * sizeof(int));
+    int *predosly_uzol = (int*)malloc(graf->pocet_uzlov * sizeof(int));
+    Halda halda = {NULL, 0, 0};
+    int *cesta = NULL;
+    int ciel = -1;
+    *dlzka = 0;
+    if(vzdialenost == NULL || predosla_hrana == NULL || predosly_uzol == NULL)
+    {
+        free(vzdialenost);
+        free(predosla_hrana);
+        free(predosly_uzol);
+        return NULL;
+    }
+    zapocitaj_pamat(PAMAT_RIESIC, 3LL * graf->pocet_uzlov * sizeof(int));
+    for(int i = 0; i < graf->pocet_uzlov; i++)
+        vzdialenost[i] = INT_MAX;
+
+    vzdialenost[start_uzol] = 0;
+    bool v_poriadku = halda_vloz(&halda, (PolozkaHaldy){0, 0, start_uzol});
+    while(v_poriadku && halda.pocet > 0)
+    {
+        PolozkaHaldy polozka = halda_vyber(&halda);
+        if(polozka.g > vzdialenost[polozka.uzol])
+            continue;
+        if(polozka.uzol != start_uzol && vedie_von(map, graf->uzly[polozka.uzol]))
+        {
+            ciel = polozka.uzol;
+            break;
+        }
+        for(int hrana = graf->zaciatky[polozka.uzol]; hrana < graf->zaciatky[polozka.uzol + 1]; hrana++)
+        {
+            int sused = graf->ciele[hrana];
+            int nova_vzdialenost = polozka.g + graf->vahy[hrana];
+            if(nova_vzdialenost >= vzdialenost[sused])
+                continue;
+            vzdialenost[sused] = nova_vzdialenost;
+            predosla_hrana[sused] = hrana;
+            predosly_uzol[sused] = polozka.uzol;
+            v_poriadku = halda_vloz(&halda, (PolozkaHaldy){nova_vzdialenost, nova_vzdialenost, sused}) && v_poriadku;
+        }
+    }
+
+    if(v_poriadku && ciel != -1)
+    {
+        *dlzka = vzdialenost[ciel] + 1;
+        cesta = (int*)malloc(*dlzka * sizeof(int));
+        int i = *dlzka - 1;
+        for(int uzol = ciel; cesta != NULL && uzol != start_uzol; uzol = predosly_uzol[uzol])
+        {
+            int hrana = predosla_hrana[uzol];
+            cesta[i--] = graf->uzly[uzol];
+            for(int j = graf->cesty_zaciatky[hrana + 1] - 1; j >= graf->cesty_zaciatky[hrana]; j--)
+                cesta[i--] = graf->cesty[j];
+        }
+        if(cesta != NULL)
+            cesta[0] = start;
+    }
+    zapocitaj_pamat(PAMAT_RIESIC, -3LL * graf->pocet_uzlov * sizeof(int));
+    free(vzdialenost);
+    free(predosla_hrana);
+    free(predosly_uzol);
+    free_halda(&halda);
+    return cesta;
+}
+
+#define HLBKA_CITANIA_DOPREDU 8
+
+/**
+ * @brief Nacitavac, ktory cita dalsie subory s bludiskami vo vlastnom vlakne
+ * 
+ * Kym sa aktualne bludisko parsuje a kontroluje, vlakno uz cita do pamate az
+ * HLBKA_CITANIA_DOPREDU nasledujucich suborov, takze cakanie na disk sa prekryva s parsovanim.
+ * Bludiska sa musia vyberat postupne v poradi, v akom su v poli subory.
+*/
+typedef struct
+{
+    char **subory;
+    int pocet;
+    char **obsahy;
+    size_t *velkosti;
+    bool *precitane;
+    int spotrebovane;
+    bool zrusit;
+    mtx_t zamok;
+    cnd_t zmena;
+    thrd_t vlakno;
+} NacitavacBludisk;
+
+/**
+ * @brief Precita cely subor do pamate
+ * 
+ * @param cesta cesta k suboru
+ * @param velkost ukazatel, kam sa ulozi pocet precitanych bajtov
+ * 
+ * @return Vracia obsah suboru alebo NULL, ak sa subor neda precitat
+*/
+char *precitaj_subor(const char *cesta, size_t *velkost)
+{
+    *velkost = 0;
+    int fd = open(cesta, O_RDONLY);
+    if(fd == -1)
+        return NULL;
+
+    struct stat informacie;
+    char *obsah = NULL;
+    if(fstat(fd, &informacie) == 0 && (obsah = (char*)malloc(informacie.st_size + 1)) != NULL)
+    {
+        while(*velkost < (size_t)informacie.st_size)
+        {
+            ssize_t precitane = read(fd, obsah + *velkost, informacie.st_size - *velkost);
+            if(precitane <= 0)
+                break;
+            *velkost += precitane;
+        }
+        obsah[*velkost] = '\0';
+        zapocitaj_pamat(PAMAT_PARSER, *velkost + 1);
+    }
+    close(fd);
+    return obsah;
+}
+
+void uvolni_obsah(char *obsah, size_t velkost)
+{
+    if(obsah != NULL)
+        zapocitaj_pamat(PAMAT_PARSER, -(long long)(velkost + 1));
+    free(obsah);
+}
+
+int citaj_dopredu(void *argument)
+{
+    NacitavacBludisk *nacitavac = (NacitavacBludisk*)argument;
+    for(int i = 0; i < nacitavac->pocet; i++)
+    {
+        mtx_lock(&nacitavac->zamok);
+        while(!nacitavac->zrusit && i >= nacitavac->spotrebovane + HLBKA_CITANIA_DOPREDU)
+            cnd_wait(&nacitavac->zmena, &nacitavac->zamok);
+        bool zrusit = nacitavac->zrusit;
+        mtx_unlock(&nacitavac->zamok);
+        if(zrusit)
+            break;
+
+        size_t velkost;
+        char *obsah = precitaj_subor(nacitavac->subory[i], &velkost);
+
+        mtx_lock(&nacitavac->zamok);
+        nacitavac->obsahy[i] = obsah;
+        nacitavac->velkosti[i] = velkost;
+        nacitavac->precitane[i] = true;
+        cnd_broadcast(&nacitavac->zmena);
+        mtx_unlock(&nacitavac->zamok);
+    }
+    return 0;
+}
+
+/**
+ * @brief Vytvori nacitavac a spusti vlakno, ktore cita subory dopredu
+ * 
+ * @param subory pole ciest k suborom, musi existovat, kym sa nacitavac nezrusi
+ * @param pocet pocet suborov
+ * 
+ * @return Vracia ukazatel na nacitavac alebo NULL pri chybe
+*/
+NacitavacBludisk *vytvor_nacitavac(char **subory, int pocet)
+{
+    NacitavacBludisk *nacitavac = (NacitavacBludisk*)calloc(1, sizeof(NacitavacBludisk));
+    if(nacitavac == NULL)
+        return NULL;
+    nacitavac->subory = subory;
+    nacitavac->pocet = pocet;
+    nacitavac->obsahy = (char**)calloc(pocet + 1, sizeof(char*));
+    nacitavac->velkosti = (size_t*)calloc(pocet + 1, sizeof(size_t));
+    nacitavac->precitane = (bool*)calloc(pocet + 1, sizeof(bool));
+    if(nacitavac->obsahy == NULL || nacitavac->velkosti == NULL || nacitavac->precitane == NULL)
+    {
+        free(nacitavac->obsahy);
+        free(nacitavac->velkosti);
+        free(nacitavac->precitane);
+        free(nacitavac);
+        return NULL;
+    }
+
+    mtx_init(&nacitavac->zamok, mtx_plain);
+    cnd_init(&nacitavac->zmena);
+    if(thrd_create(&nacitavac->vlakno, citaj_dopredu, nacitavac) != thrd_success)
+    {
+        mtx_destroy(&nacitavac->zamok);
+        cnd_destroy(&nacitavac->zmena);
+        free(nacitavac->obsahy);
+        free(nacitavac->velkosti);
+        free(nacitavac->precitane);
+        free(nacitavac);
+        return NULL;
+    }
+    return nacitavac;
+}
+
+/**
+ * @brief Vyberie dalsie bludisko z nacitavaca a naparsuje ho
+ * 
+ * Ak subor este nie je precitany, pocka nan. Obsah sa parsuje cez fmemopen tou istou
+ * funkciou nacitaj_mapu ako v get_map, takze vysledok je rovnaky.
+ * 
+ * @param nacitavac ukazatel na nacitavac
+ * 
+ * @return Vracia mapu dalsieho bludiska alebo NULL, ak nie je platne alebo uz ziadne nie je
+*/
+Map *nacitavac_dalsia(NacitavacBludisk *nacitavac)
+{
+    mtx_lock(&nacitavac->zamok);
+    int index = nacitavac->spotrebovane;
+    if(index >= nacitavac->pocet)
+    {
+        mtx_unlock(&nacitavac->zamok);
+        return NULL;
+    }
+    while(!nacitavac->precitane[index])
+        cnd_wait(&nacitavac->zmena, &nacitavac->zamok);
+    char *obsah = nacitavac->obsahy[index];
+    size_t velkost = nacitavac->velkosti[index];
+    nacitavac->obsahy[index] = NULL;
+    nacitavac->spotrebovane++;
+    cnd_broadcast(&nacitavac->zmena);
+    mtx_unlock(&nacitavac->zamok);
+
+    FILE *subor_bludiska = obsah != NULL ? fmemopen(obsah, velkost > 0 ? velkost : 1, "r") : NULL;
+    if(subor_bludiska == NULL)
+    {
+        fprintf(stderr, "Invalid\n");
+        uvolni_obsah(obsah, velkost);
+        return NULL;
+    }
+    Map *mapa_bludiska = nacitaj_mapu_v_tvare(subor_bludiska, nizka_spotreba_pamate);
+    fclose(subor_bludiska);
+    uvolni_obsah(obsah, velkost);
+    return mapa_bludiska;
+}
+
+/**
+ * @brief Zastavi citacie vlakno a uvolni nacitavac aj subory, ktore sa nestihli spracovat
+ * 
+ * @param nacitavac ukazatel na nacitavac
+*/
+void free_nacitavac(NacitavacBludisk *nacitavac)
+{
+    if(nacitavac == NULL)
+        return;
+    mtx_lock(&nacitavac->zamok);
+    nacitavac->zrusit = true;
+    cnd_broadcast(&nacitavac->zmena);
+    mtx_unlock(&nacitavac->zamok);
+    thrd_join(nacitavac->vlakno, NULL);
+
+    for(int i = 0; i < nacitavac->pocet; i++)
+        uvolni_obsah(nacitavac->obsahy[i], nacitavac->velkosti[i]);
+    mtx_destroy(&nacitavac->zamok);
+    cnd_destroy(&nacitavac->zmena);
+    free(nacitavac->obsahy);
+    free(nacitavac->velkosti);
+    free(nacitavac->precitane);
+    free(nacitavac);
+}
+
+/**
+ * @brief Funkcia, ktoru paralelne spusta spusti_paralelne pre kazdu ulohu
+ * 
+ * @param index poradove cislo ulohy
+ * @param kontext ukazatel na data spolocne pre vsetky ulohy
+*/
+typedef void (*UlohaFunkcia)(int index, void *kontext);
+
+typedef struct
+{
+    mtx_t zamok;
+    int zaciatok;
+    int koniec;
+} FrontaUloh;
+
+typedef struct
+{
+    FrontaUloh *fronty;
+    int pocet_vlakien;
+    UlohaFunkcia uloha;
+    void *kontext;
+} PoolUloh;
+
+typedef struct
+{
+    PoolUloh *pool;
+    int id;
+} Pracovnik;
+
+typedef enum
+{
+    PRIKAZ_TEST,
+    PRIKAZ_RPATH,
+    PRIKAZ_LPATH,
+    PRIKAZ_VSTUPY,
+} PRIKAZ;
+
+typedef struct
+{
+    char **subory;
+    char **vysledky;
+    size_t *dlzky;
+    PRIKAZ prikaz;
+    int r;
+    int c;
+    NacitavacBludisk *nacitavac;
+} DavkaBludisk;
+
+/**
+ * @brief Zisti, kolko vlakien sa ma pouzit
+ * 
+ * Pocet sa da nastavit premennou prostredia MAZE_THREADS, inak sa pouzije pocet dostupnych jadier
+ * 
+ * @return Vracia pocet vlakien, aspon 1
+*/
+int pocet_vlakien(void)
+{
+    char *nastavenie = getenv("MAZE_THREADS");
+    if(nastavenie != NULL && atoi(nastavenie) > 0)
+        return atoi(nastavenie);
+
+    long pocet_jadier = sysconf(_SC_NPROCESSORS_ONLN);
+    return pocet_jadier > 0 ? (int)pocet_jadier : 1;
+}
+
+/**
+ * @brief Vyberie jednu ulohu z fronty
+ * 
+ * Vlastnik fronty berie ulohy zo zaciatku, ostatne vlakna mu ich kradnu z konca
+ * 
+ * @param fronta ukazatel na frontu uloh
+ * @param od_konca ci sa ma uloha vziat z konca fronty
+ * 
+ * @return Vracia index ulohy alebo -1, ak je fronta prazdna
+*/
+int vezmi_ulohu(FrontaUloh *fronta, bool od_konca)
+{
+    int index = -1;
+    mtx_lock(&fronta->zamok);
+    if(fronta->zaciatok < fronta->koniec)
+        index = od_konca ? --fronta->koniec : fronta->zaciatok++;
+    mtx_unlock(&fronta->zamok);
+    return index;
+}
+
+/**
+ * @brief Hlavna slucka vlakna, spracuva ulohy zo svojej fronty, potom krade z ostatnych
+ * 
+ * Ulohy sa do front uz nepridavaju, takze ked su vsetky fronty prazdne, vlakno skonci
+ * 
+ * @param argument ukazatel na strukturu Pracovnik
+ * 
+ * @return Vracia 0
+*/
+int pracuj(void *argument)
+{
+    Pracovnik *pracovnik = (Pracovnik*)argument;
+    PoolUloh *pool = pracovnik->pool;
+    while(true)
+    {
+        int index = vezmi_ulohu(&pool->fronty[pracovnik->id], false);
+        for(int i = 1; index == -1 && i < pool->pocet_vlakien; i++)
+            index = vezmi_ulohu(&pool->fronty[(pracovnik->id + i) % pool->pocet_vlakien], true);
+        if(index == -1)
+            return 0;
+        pool->uloha(index, pool->kontext);
+    }
+}
+
+/**
+ * @brief Spusti ulohy 0 az pocet_uloh - 1 na viacerych vlaknach s kradnutim prace
+ * 
+ * Kazde vlakno dostane suvisly usek uloh, a ked ho dokonci, krade ulohy ostatnym.
+ * Volajuce vlakno pracuje tiez, funkcia sa vrati az po dokonceni vsetkych uloh
+ * 
+ * @param pocet_uloh pocet uloh
+ * @param pocet_vlakien maximalny pocet vlakien
+ * @param uloha funkcia, ktora sa zavola pre kazdu ulohu
+ * @param kontext ukazatel, ktory sa posunie kazdej ulohe
+*/
+void spusti_paralelne(int pocet_uloh, int pocet_vlakien, UlohaFunkcia uloha, void *kontext)
+{
+    if(pocet_vlakien > pocet_uloh)
+        pocet_vlakien = pocet_uloh;
+
+    FrontaUloh *fronty = NULL;
+    Pracovnik *pracovnici = NULL;
+    thrd_t *vlakna = NULL;
+    bool *spustene = NULL;
+    if(pocet_vlakien > 1)
+    {
+        fronty = (FrontaUloh*)malloc(pocet_vlakien * sizeof(FrontaUloh));
+        pracovnici = (Pracovnik*)malloc(pocet_vlakien * sizeof(Pracovnik));
+        vlakna = (thrd_t*)malloc(pocet_vlakien * sizeof(thrd_t));
+        spustene = (bool*)calloc(pocet_vlakien, sizeof(bool));
+    }
+    if(fronty == NULL || pracovnici == NULL || vlakna == NULL || spustene == NULL)
+    {
+        free(fronty);
+        free(pracovnici);
+        free(vlakna);
+        free(spustene);
+        for(int i = 0; i < pocet_uloh; i++)
+            uloha(i, kontext);
+        return;
+    }
+
+    PoolUloh pool = {fronty, pocet_vlakien, uloha, kontext};
+    for(int i = 0; i < pocet_vlakien; i++)
+    {
+        mtx_init(&fronty[i].zamok, mtx_plain);
+        fronty[i].zaciatok = (int)((long long)pocet_uloh * i / pocet_vlakien);
+        fronty[i].koniec = (int)((long long)pocet_uloh * (i + 1) / pocet_vlakien);
+        pracovnici[i].pool = &pool;
+        pracovnici[i].id = i;
+    }
+    for(int i = 1; i < pocet_vlakien; i++)
+        spustene[i] = (thrd_create(&vlakna[i], pracuj, &pracovnici[i]) == thrd_success);
+    pracuj(&pracovnici[0]);
+    for(int i = 1; i < pocet_vlakien; i++)
+    {
+        if(spustene[i])
+            thrd_join(vlakna[i], NULL);
+    }
+
+    for(int i = 0; i < pocet_vlakien; i++)
+        mtx_destroy(&fronty[i].zamok);
+    free(fronty);
+    free(pracovnici);
+    free(vlakna);
+    free(spustene);
+}
+
+#define BLOK_SKOKOV 4096
+
+/**
+ * @brief Tabulka skokov pre prechod jednou rukou
+ * 
+ * Stav 4 * policko + smer je policko, ktore sa ma vypisat ako dalsie, a smer, ktorym sa na neho prislo.
+ * Stavy od 4 * pocet policok vyssie su koncove, 4 * pocet policok + policko znamena, ze prechod
+ * vysiel z bludiska po vypisani policka. Koncove stavy skacu same na seba.
+ * skoky[k * pocet_stavov + stav] je stav o 2^k krokov neskor.
+*/
+typedef struct
+{
+    int pocet_policok;
+    int pocet_stavov;
+    int pocet_urovni;
+    int *skoky;
+} TabulkaSkokov;
+
+typedef struct
+{
+    Map *map;
+    TabulkaSkokov *tabulka;
+    int leftright;
+    int uroven;
+} StavbaSkokov;
+
+void free_tabulka_skokov(TabulkaSkokov *tabulka)
+{
+    if(tabulka == NULL)
+        return;
+    zapocitaj_pamat(PAMAT_RIESIC, -(long long)tabulka->pocet_urovni * tabulka->pocet_stavov * sizeof(int));
+    free(tabulka->skoky);
+    free(tabulka);
+}
+
+/**
+ * @brief Vyplni jeden blok stavov jednej urovne tabulky skokov
+ * 
+ * Uroven 0 sa pocita jednym krokom algoritmu, kazda dalsia zdvojenim predchadzajucej
+ * 
+ * @param index poradove cislo bloku
+ * @param kontext ukazatel na strukturu StavbaSkokov
+*/
+void vypln_skoky(int index, void *kontext)
+{
+    StavbaSkokov *stavba = (StavbaSkokov*)kontext;
+    TabulkaSkokov *tabulka = stavba->tabulka;
+    int zaciatok = index * BLOK_SKOKOV;
+    int koniec = zaciatok + BLOK_SKOKOV < tabulka->pocet_stavov ? zaciatok + BLOK_SKOKOV : tabulka->pocet_stavov;
+    int *uroven = tabulka->skoky + (size_t)stavba->uroven * tabulka->pocet_stavov;
+    int *predosla = uroven - tabulka->pocet_stavov;
+    int prvy_koncovy = 4 * tabulka->pocet_policok;
+
+    for(int stav = zaciatok; stav < koniec; stav++)
+    {
+        if(stavba->uroven > 0)
+            uroven[stav] = predosla[predosla[stav]];
+        else if(stav >= prvy_koncovy)
+            uroven[stav] = stav;
+        else
+        {
+            int policko = stav / 4;
+            int r = policko / stavba->map->cols, c = policko % stavba->map->cols;
+            int aktualny_smer = krok(stavba->map, &r, &c, stav % 4, stavba->leftright);
+
+            if(r > -1 && c > -1 && r < stavba->map->rows && c < stavba->map->cols)
+                uroven[stav] = 4 * (r * stavba->map->cols + c) + aktualny_smer;
+            else
+                uroven[stav] = prvy_koncovy + policko;
+        }
+    }
+}
+
+/**
+ * @brief Postavi tabulku skokov pre vsetky stavy jednej ruky
+ * 
+ * Kazda uroven sa vyplna paralelne po blokoch stavov, urovne idu po sebe, lebo kazda cita predoslu.
+ * Urovni je tolko, aby najvyssi skok presiahol 4 * pocet policok, dlhsie prechody sa uz zacyklili.
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * @param leftright pravidlo pravej/lavej ruky
+ * @param pocet_vlakien maximalny pocet vlakien
+ * 
+ * @return Vracia ukazatel na tabulku alebo NULL pri chybe
+*/
+TabulkaSkokov *vytvor_tabulku_skokov(Map *map, int leftright, int pocet_vlakien)
+{
+    int pocet_policok = map->rows * map->cols;
+    if(pocet_policok > INT_MAX / 5)
+        return NULL;
+
+    TabulkaSkokov *tabulka = (TabulkaSkokov*)malloc(sizeof(TabulkaSkokov));
+    if(tabulka == NULL)
+        return NULL;
+    tabulka->pocet_policok = pocet_policok;
+    tabulka->pocet_stavov = 5 * pocet_policok;
+    tabulka->pocet_urovni = 1;
+    while((1LL << (tabulka->pocet_urovni - 1)) <= 4LL * pocet_policok)
+        tabulka->pocet_urovni++;
+    tabulka->skoky = (int*)malloc((size_t)tabulka->pocet_urovni * tabulka->pocet_stavov * sizeof(int));
+    if(tabulka->skoky == NULL)
+    {
+        free(tabulka);
+        return NULL;
+    }
+
+    zapocitaj_pamat(PAMAT_RIESIC, (long long)tabulka->pocet_urovni * tabulka->pocet_stavov * sizeof(int));
+    StavbaSkokov stavba = {map, tabulka, leftright, 0};
+    int pocet_blokov = (tabulka->pocet_stavov + BLOK_SKOKOV - 1) / BLOK_SKOKOV;
+    for(stavba.uroven = 0; stavba.uroven < tabulka->pocet_urovni; stavba.uroven++)
+        spusti_paralelne(pocet_blokov, pocet_vlakien, vypln_skoky, &stavba);
+    return tabulka;
+}
+
+/**
+ * @brief Posunie stav o dany pocet krokov, jedno vyhladanie na kazdy nastaveny bit
+ * 
+ * @param tabulka ukazatel na tabulku skokov
+ * @param stav pociatocny stav
+ * @param kroky pocet krokov
+ * 
+ * @return Vracia stav o kroky krokov neskor
+*/
+int skoc_o(TabulkaSkokov *tabulka, int stav, long long kroky)
+{
+    int najvyssia = tabulka->pocet_urovni - 1;
+    for(; kroky >= (1LL << najvyssia); kroky -= 1LL << najvyssia)
+        stav = tabulka->skoky[(size_t)najvyssia * tabulka->pocet_stavov + stav];
+    for(int k = 0; kroky > 0; k++, kroky >>= 1)
+    {
+        if(kroky & 1)
+            stav = tabulka->skoky[(size_t)k * tabulka->pocet_stavov + stav];
+    }
+    return stav;
+}
+
+/**
+ * @brief Zisti dlzku prechodu a policko, z ktoreho vyjde von, v logaritmickom case
+ * 
+ * Skace sa od najvyssej urovne nadol, pokial skok nekonci v koncovom stave
+ * 
+ * @param tabulka ukazatel na tabulku skokov
+ * @param stav pociatocny stav
+ * @param vychod ukazatel, kam sa zapise index posledneho policka
+ * 
+ * @return Vracia pocet vypisanych policok alebo -1, ak sa prechod zacykli
+*/
+long long dlzka_prechodu(TabulkaSkokov *tabulka, int stav, int *vychod)
+{
+    int prvy_koncovy = 4 * tabulka->pocet_policok;
+    long long kroky = 0;
+    for(int k = tabulka->pocet_urovni - 1; k >= 0; k--)
+    {
+        int dalsi = tabulka->skoky[(size_t)k * tabulka->pocet_stavov + stav];
+        if(dalsi < prvy_koncovy)
+        {
+            stav = dalsi;
+            kroky += 1LL << k;
+        }
+    }
+
+    stav = tabulka->skoky[stav];
+    if(stav < prvy_koncovy)
+        return -1;
+    *vychod = stav - prvy_koncovy;
+    return kroky + 1;
+}
+
+/**
+ * @brief Vypise vychod a dlzku prechodu oboch ruk pre kazde okrajove policko
+ * 
+ * Pre kazdu ruku sa postavi jedna tabulka skokov a z nej sa v logaritmickom case zodpovedaju
+ * vsetky okrajove vstupy, potom sa tabulka uvolni, takze naraz je v pamati iba jedna.
+ * Riadky su v rovnakom poradi ako vo vypis_vstupy, "-" je neplatny vstup a "loop" zacykleny prechod.
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * @param vystup subor, do ktoreho sa suhrn vypise
+ * 
+ * @return Vracia false, ak nestacila pamat
+*/
+bool vypis_suhrn_vstupov(Map *map, FILE *vystup)
+{
+    int pocet = pocet_okrajovych(map);
+    long long *dlzky = (long long*)malloc(2 * pocet * sizeof(long long));
+    int *vychody = (int*)malloc(2 * pocet * sizeof(int));
+    if(dlzky == NULL || vychody == NULL)
+    {
+        free(dlzky);
+        free(vychody);
+        return false;
+    }
+    zapocitaj_pamat(PAMAT_RIESIC, 2LL * pocet * (sizeof(long long) + sizeof(int)));
+
+    for(int leftright = LEFT_PATH; leftright <= RIGHT_PATH; leftright++)
+    {
+        TabulkaSkokov *tabulka = vytvor_tabulku_skokov(map, leftright, pocet_vlakien());
+        if(tabulka == NULL)
+        {
+            zapocitaj_pamat(PAMAT_RIESIC, -2LL * pocet * (sizeof(long long) + sizeof(int)));
+            free(dlzky);
+            free(vychody);
+            return false;
+        }
+        for(int r = 0; r < map->rows; r++)
+        {
+            bool okrajovy_rad = (r == 0 || r == map->rows - 1);
+            for(int c = 0; c < map->cols; c += (okrajovy_rad || map->cols == 1) ? 1 : map->cols - 1)
+            {
+                int index = 2 * okrajovy_index(map, r, c) + leftright;
+                int aktualny_smer = entrance_direction(map, r, c, leftright);
+                dlzky[index] = aktualny_smer == -1 ? -2 : dlzka_prechodu(tabulka, 4 * (r * map->cols + c) + aktualny_smer, &vychody[index]);
             }
-            else if(horna_or_dolna_hranica == DOLNA_HRANICA)
+        }
+        free_tabulka_skokov(tabulka);
+    }
+
+    for(int r = 0; r < map->rows; r++)
+    {
+        bool okrajovy_rad = (r == 0 || r == map->rows - 1);
+        for(int c = 0; c < map->cols; c += (okrajovy_rad || map->cols == 1) ? 1 : map->cols - 1)
+        {
+            fprintf(vystup, "%d,%d", r + 1, c + 1);
+            for(int leftright = LEFT_PATH; leftright <= RIGHT_PATH; leftright++)
             {
-                if(is_border(map, r, c, PRAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOPRAVA;
-                    c++;
-                }
-                else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, DOLNA_HRANICA) == false)
-                {
-                    aktualny_smer = DOLE;
-                    r++;
-                }
-                else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, DOLNA_HRANICA) == true)
-                {
-                    aktualny_smer = DOLAVA;
-                    c--;
-                }
+                int index = 2 * okrajovy_index(map, r, c) + leftright;
+                const char *nazov = leftright == RIGHT_PATH ? "rpath" : "lpath";
+                if(dlzky[index] == -2)
+                    fprintf(vystup, " %s:-", nazov);
+                else if(dlzky[index] == -1)
+                    fprintf(vystup, " %s:loop", nazov);
+                else
+                    fprintf(vystup, " %s:%d,%d/%lld", nazov, vychody[index] / map->cols + 1, vychody[index] % map->cols + 1, dlzky[index]);
+            }
+            fprintf(vystup, "\n");
+        }
+    }
+    zapocitaj_pamat(PAMAT_RIESIC, -2LL * pocet * (sizeof(long long) + sizeof(int)));
+    free(dlzky);
+    free(vychody);
+    return true;
+}
+
+#define RENDER_RIADKY_PASMA 8
+#define RENDER_MAX_SIRKA 16384
+#define RENDER_MAX_BUFFERY (64 << 20)
+
+typedef struct
+{
+    Map *map;
+    unsigned char *cesta;
+    int strana;
+    int vyska;
+    int hrubka;
+    int sirka;
+    int prvy_pas;
+    unsigned char **buffery;
+} Vykreslenie;
+
+/**
+ * @brief Vyplni usek jedneho riadku obrazka farbou
+*/
+void vypln_pixely(unsigned char *riadok, int od, int po, const unsigned char farba[3])
+{
+    for(int x = od; x < po; x++)
+        memcpy(riadok + 3 * x, farba, 3);
+}
+
+/**
+ * @brief Vykresli jedno pasmo RENDER_RIADKY_PASMA radov bludiska do svojho buffera
+ * 
+ * Policko c ma zaciatok na x = c * strana a je siroke 2 * strana, susedne trojuholniky sa prekryvaju
+ * o polovicu. V pixelovom riadku ty ma trojuholnik s hornou hranicou polovicnu sirku
+ * a = strana * (vyska - ty) / vyska a trojuholnik s dolnou hranicou strana - a, takze sa useky
+ * susedov presne dotykaju a kazdy pixel riadku patri najviac jednemu policku.
+ * 
+ * @param index poradove cislo pasma v skupine
+ * @param kontext ukazatel na strukturu Vykreslenie
+*/
+void vykresli_pasmo(int index, void *kontext)
+{
+    const unsigned char POZADIE[3] = {255, 255, 255};
+    const unsigned char HORNE[3] = {245, 245, 245};
+    const unsigned char DOLNE[3] = {225, 225, 225};
+    const unsigned char CESTA[3] = {230, 60, 50};
+    const unsigned char STENA[3] = {0, 0, 0};
+
+    Vykreslenie *vykreslenie = (Vykreslenie*)kontext;
+    Map *map = vykreslenie->map;
+    int strana = vykreslenie->strana, vyska = vykreslenie->vyska, hrubka = vykreslenie->hrubka;
+    int prvy_rad = (vykreslenie->prvy_pas + index) * RENDER_RIADKY_PASMA;
+    int koniec = prvy_rad + RENDER_RIADKY_PASMA < map->rows ? prvy_rad + RENDER_RIADKY_PASMA : map->rows;
+    unsigned char *riadok = vykreslenie->buffery[index];
+
+    for(int r = prvy_rad; r < koniec; r++)
+    {
+        for(int ty = 0; ty < vyska; ty++, riadok += 3 * vykreslenie->sirka)
+        {
+            vypln_pixely(riadok, 0, vykreslenie->sirka, POZADIE);
+            int a = strana * (vyska - ty) / vyska;
+            for(int c = 0; c < map->cols; c++)
+            {
+                int index_policka = r * map->cols + c;
+                bool horna = horna_dolna_hranica(r, c) == HORNA_HRANICA;
+                int polovica = horna ? a : strana - a;
+                int lavy = c * strana + strana - polovica, pravy = lavy + 2 * polovica;
+                if(polovica == 0)
+                    continue;
+
+                bool na_ceste = vykreslenie->cesta != NULL && (vykreslenie->cesta[index_policka / 8] & (1 << (index_policka % 8)));
+                vypln_pixely(riadok, lavy, pravy, na_ceste ? CESTA : horna ? HORNE : DOLNE);
+                if((horna ? ty : vyska - 1 - ty) < hrubka && is_border(map, r, c, horna ? HORNA_HRANICA : DOLNA_HRANICA))
+                    vypln_pixely(riadok, lavy, pravy, STENA);
+                if(is_border(map, r, c, LAVA_HRANICA))
+                    vypln_pixely(riadok, lavy, lavy + hrubka < pravy ? lavy + hrubka : pravy, STENA);
+                if(is_border(map, r, c, PRAVA_HRANICA))
+                    vypln_pixely(riadok, pravy - hrubka > lavy ? pravy - hrubka : lavy, pravy, STENA);
             }
         }
-        else if(aktualny_smer == HORE)
+    }
+}
+
+/**
+ * @brief Oznaci policka, cez ktore prejde algoritmus pravej alebo lavej ruky
+ * 
+ * Prechod sa zastavi po 4 * pocet policok krokoch, potom by sa uz iba opakoval
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * @param r riadok vstupu
+ * @param c stlpec vstupu
+ * @param leftright pravidlo pravej/lavej ruky
+ * @param pocet_na_ceste ukazatel, kam sa ulozi pocet roznych policok cesty
+ * 
+ * @return Vracia bitovu masku policok cesty, NULL pri neplatnom vstupe alebo nedostatku pamate
+*/
+unsigned char *oznac_cestu(Map *map, int r, int c, int leftright, int *pocet_na_ceste)
+{
+    *pocet_na_ceste = 0;
+    int aktualny_smer = entrance_direction(map, r, c, leftright);
+    if(aktualny_smer == -1)
+        return NULL;
+    int pocet_policok = map->rows * map->cols;
+    unsigned char *cesta = (unsigned char*)calloc(pocet_policok / 8 + 1, sizeof(unsigned char));
+    if(cesta == NULL)
+        return NULL;
+    zapocitaj_pamat(PAMAT_RIESIC, pocet_policok / 8 + 1);
+
+    long long limit = 4LL * pocet_policok;
+    for(long long i = 0; i < limit && r > -1 && c > -1 && r < map->rows && c < map->cols; i++)
+    {
+        int index = r * map->cols + c;
+        if(!(cesta[index / 8] & (1 << (index % 8))))
+            (*pocet_na_ceste)++;
+        cesta[index / 8] |= 1 << (index % 8);
+        aktualny_smer = krok(map, &r, &c, aktualny_smer, leftright);
+    }
+    return cesta;
+}
+
+/**
+ * @brief Zapise bludisko ako obrazok PPM, volitelne s vyznacenou cestou
+ * 
+ * Obrazok sa vykresluje po pasmach RENDER_RIADKY_PASMA radov, skupina pasiem sa vykresli
+ * paralelne a hned sa zapise. Pasiem v skupine je najviac 2 * pocet vlakien a spolu maju
+ * najviac RENDER_MAX_BUFFERY bajtov, vzdy je aspon jedno pasmo.
+ * Velkost trojuholnika sa da nastavit premennou prostredia MAZE_RENDER_SCALE (polovica sirky
+ * v pixeloch), inak sa zmensuje, kym obrazok nie je najviac RENDER_MAX_SIRKA siroky, ale nie pod 2,
+ * takze bludiska s viac ako RENDER_MAX_SIRKA / 2 - 1 stlpcami budu sirsie.
+ * 
+ * @param map ukazatel na mapu bludiska v strukture Map
+ * @param cesta_vystupu cesta k vystupnemu suboru
+ * @param cesta bitova maska policok cesty alebo NULL
+ * @param sirka ukazatel, kam sa ulozi sirka obrazka
+ * @param vyska ukazatel, kam sa ulozi vyska obrazka
+ * 
+ * @return Vracia true, ak sa obrazok podarilo zapisat
+*/
+bool vykresli_bludisko(Map *map, const char *cesta_vystupu, unsigned char *cesta, int *sirka, int *vyska)
+{
+    int strana = 8;
+    char *nastavenie = getenv("MAZE_RENDER_SCALE");
+    if(nastavenie != NULL && atoi(nastavenie) >= 2 && atoi(nastavenie) <= 1024)
+        strana = atoi(nastavenie);
+    else
+    {
+        while(strana > 2 && (long long)(map->cols + 1) * strana > RENDER_MAX_SIRKA)
+            strana /= 2;
+    }
+    // vyska rovnostranneho trojuholnika je priblizne 7/4 polovice jeho sirky
+    Vykreslenie vykreslenie = {map, cesta, strana, strana * 7 / 4, strana / 6 > 1 ? strana / 6 : 1, 0, 0, NULL};
+    if((long long)(map->cols + 1) * strana > INT_MAX / 3 || (long long)map->rows * vykreslenie.vyska > INT_MAX)
+        return false;
+    vykreslenie.sirka = (map->cols + 1) * strana;
+    *sirka = vykreslenie.sirka;
+    *vyska = map->rows * vykreslenie.vyska;
+
+    FILE *subor = fopen(cesta_vystupu, "wb");
+    if(subor == NULL)
+        return false;
+    fprintf(subor, "P6\n%d %d\n255\n", *sirka, *vyska);
+
+    int pocet_pasiem = (map->rows + RENDER_RIADKY_PASMA - 1) / RENDER_RIADKY_PASMA;
+    size_t velkost_pasma = (size_t)3 * vykreslenie.sirka * vykreslenie.vyska * RENDER_RIADKY_PASMA;
+    int v_skupine = 2 * pocet_vlakien();
+    if((size_t)v_skupine * velkost_pasma > RENDER_MAX_BUFFERY)
+        v_skupine = RENDER_MAX_BUFFERY / velkost_pasma > 0 ? (int)(RENDER_MAX_BUFFERY / velkost_pasma) : 1;
+    if(v_skupine > pocet_pasiem)
+        v_skupine = pocet_pasiem;
+    vykreslenie.buffery = (unsigned char**)calloc(v_skupine, sizeof(unsigned char*));
+    bool v_poriadku = vykreslenie.buffery != NULL;
+    for(int i = 0; v_poriadku && i < v_skupine; i++)
+    {
+        vykreslenie.buffery[i] = (unsigned char*)malloc(velkost_pasma);
+        v_poriadku = vykreslenie.buffery[i] != NULL;
+    }
+    bool zapocitane = v_poriadku;
+    if(zapocitane)
+        zapocitaj_pamat(PAMAT_RIESIC, (long long)v_skupine * velkost_pasma);
+
+    for(vykreslenie.prvy_pas = 0; v_poriadku && vykreslenie.prvy_pas < pocet_pasiem; vykreslenie.prvy_pas += v_skupine)
+    {
+        int pocet = pocet_pasiem - vykreslenie.prvy_pas < v_skupine ? pocet_pasiem - vykreslenie.prvy_pas : v_skupine;
+        spusti_paralelne(pocet, pocet_vlakien(), vykresli_pasmo, &vykreslenie);
+        for(int i = 0; v_poriadku && i < pocet; i++)
+        {
+            int prvy_rad = (vykreslenie.prvy_pas + i) * RENDER_RIADKY_PASMA;
+            int radov = map->rows - prvy_rad < RENDER_RIADKY_PASMA ? map->rows - prvy_rad : RENDER_RIADKY_PASMA;
+            size_t bajty = (size_t)3 * vykreslenie.sirka * vykreslenie.vyska * radov;
+            v_poriadku = fwrite(vykreslenie.buffery[i], 1, bajty, subor) == bajty;
+        }
+    }
+
+    if(zapocitane)
+        zapocitaj_pamat(PAMAT_RIESIC, -(long long)v_skupine * velkost_pasma);
+    for(int i = 0; vykreslenie.buffery != NULL && i < v_skupine; i++)
+        free(vykreslenie.buffery[i]);
+    free(vykreslenie.buffery);
+    return (fclose(subor) == 0) && v_poriadku;
+}
+
+int porovnaj_nazvy(const void *a, const void *b)
+{
+    return strcmp(*(char* const*)a, *(char* const*)b);
+}
+
+/**
+ * @brief Najde vsetky subory *.txt v adresari
+ * 
+ * @param adresar cesta k adresaru
+ * @param pocet ukazatel, kam sa ulozi pocet najdenych suborov
+ * 
+ * @return Vracia abecedne zoradene pole ciest k suborom alebo NULL pri chybe
+*/
+char **najdi_bludiska(const char *adresar, int *pocet)
+{
+    DIR *priecinok = opendir(adresar);
+    if(priecinok == NULL)
+        return NULL;
+
+    int kapacita = 16;
+    char **subory = (char**)malloc(kapacita * sizeof(char*));
+    *pocet = 0;
+    struct dirent *polozka;
+    while(subory != NULL && (polozka = readdir(priecinok)) != NULL)
+    {
+        size_t dlzka_nazvu = strlen(polozka->d_name);
+        if(dlzka_nazvu < 5 || strcmp(polozka->d_name + dlzka_nazvu - 4, ".txt") != 0)
+            continue;
+        if(*pocet == kapacita)
         {
-            if(horna_or_dolna_hranica == DOLNA_HRANICA)
-            {
-                if(is_border(map, r, c, LAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOLAVA;
-                    c--;
-                }
-                else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, PRAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOPRAVA;
-                    c++;
-                }
-                else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, PRAVA_HRANICA) == true)
-                {
-                    aktualny_smer = DOLE;
-                    r++;
-                }
-            }
-            else if(horna_or_dolna_hranica == HORNA_HRANICA)
+            kapacita *= 2;
+            char **vacsie = (char**)realloc(subory, kapacita * sizeof(char*));
+            if(vacsie == NULL)
             {
-                if(is_border(map, r, c, LAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOLAVA;
-                    c--;
-                }
-                else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, HORNA_HRANICA) == false)
-                {
-                    aktualny_smer = HORE;
-                    r--;
-                }
-                else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, HORNA_HRANICA) == true)
-                {
-                    aktualny_smer = DOPRAVA;
-                    c++;
-                }
+                for(int i = 0; i < *pocet; i++)
+                    free(subory[i]);
+                free(subory);
+                subory = NULL;
+                break;
             }
+            subory = vacsie;
         }
-        else if(aktualny_smer == DOLE)
+        char *cesta = (char*)malloc(strlen(adresar) + dlzka_nazvu + 2);
+        if(cesta == NULL)
+            continue;
+        sprintf(cesta, "%s/%s", adresar, polozka->d_name);
+        subory[(*pocet)++] = cesta;
+    }
+    closedir(priecinok);
+
+    if(subory != NULL)
+        qsort(subory, *pocet, sizeof(char*), porovnaj_nazvy);
+    return subory;
+}
+
+/**
+ * @brief Nacita jedno bludisko z davky a spusti nad nim prikaz, vystup si ulozi do pamate
+ * 
+ * @param index poradove cislo bludiska v davke
+ * @param kontext ukazatel na strukturu DavkaBludisk
+*/
+void spracuj_bludisko(int index, void *kontext)
+{
+    DavkaBludisk *davka = (DavkaBludisk*)kontext;
+    // nacitavac vydava mapy v poradi volani, preto sa mapa vyberie aj vtedy, ked sa vystup nepodari otvorit
+    Map *mapa = davka->nacitavac != NULL ? nacitavac_dalsia(davka->nacitavac) : get_map(davka->subory[index]);
+    FILE *vystup = open_memstream(&davka->vysledky[index], &davka->dlzky[index]);
+    if(vystup == NULL)
+    {
+        if(mapa != NULL)
+            free_map(mapa);
+        return;
+    }
+
+    if(mapa == NULL)
+        fprintf(vystup, "Invalid\n");
+    else
+    {
+        switch (davka->prikaz)
         {
-            if(horna_or_dolna_hranica == HORNA_HRANICA)
-            {
-                if(is_border(map, r, c, PRAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOPRAVA;
-                    c++;
-                }
-                else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, LAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOLAVA;
-                    c--;
-                }
-                else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, LAVA_HRANICA) == true)
-                {
-                    aktualny_smer = HORE;
-                    r--;
-                }
-            }
-            else if(horna_or_dolna_hranica == DOLNA_HRANICA)
-            {
-                if(is_border(map, r, c, PRAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOPRAVA;
-                    c++;
-                }
-                else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, DOLNA_HRANICA) == false)
-                {
-                    aktualny_smer = DOLE;
-                    r++;
-                }
-                else if(is_border(map, r, c, PRAVA_HRANICA) == true && is_border(map, r, c, DOLNA_HRANICA) == true)
-                {
-                    aktualny_smer = DOLAVA;
-                    c--;
-                }
-            }
+        case PRIKAZ_TEST:
+            fprintf(vystup, "Valid\n");
+            break;
+        case PRIKAZ_RPATH:
+            rpath_algoritmus(mapa, davka->r, davka->c, vystup);
+            break;
+        case PRIKAZ_LPATH:
+            lpath_algoritmus(mapa, davka->r, davka->c, vystup);
+            break;
+        case PRIKAZ_VSTUPY:
+            vypis_vstupy(mapa, vystup);
+            break;
         }
-        else if(aktualny_smer == DOLAVA)
+        free_map(mapa);
+    }
+    fclose(vystup);
+}
+
+/**
+ * @brief Spusti prikaz nad vsetkymi bludiskami v adresari
+ * 
+ * Bludiska sa spracuvaju paralelne, vysledky sa vypisu az na konci v poradi podla nazvu suboru,
+ * takze vystup nezavisi od poctu vlakien. S jedinym vlaknom sa bludiska spracuvaju postupne
+ * a subory sa citaju dopredu cez NacitavacBludisk.
+ * 
+ * @param adresar cesta k adresaru s bludiskami
+ * @param prikaz prikaz, ktory sa ma nad kazdym bludiskom spustit
+ * @param r riadok vstupu pre --rpath/--lpath
+ * @param c stlpec vstupu pre --rpath/--lpath
+ * 
+ * @return Vracia 0 pri uspechu, 1 ak sa adresar nepodarilo precitat
+*/
+int spracuj_adresar(const char *adresar, PRIKAZ prikaz, int r, int c)
+{
+    int pocet = 0;
+    char **subory = najdi_bludiska(adresar, &pocet);
+    if(subory == NULL)
+    {
+        fprintf(stderr, "Error, cannot read directory %s\n", adresar);
+        return 1;
+    }
+
+    int vlakna = pocet_vlakien();
+    DavkaBludisk davka = {subory, (char**)calloc(pocet + 1, sizeof(char*)), (size_t*)calloc(pocet + 1, sizeof(size_t)), prikaz, r, c, NULL};
+    if(davka.vysledky != NULL && davka.dlzky != NULL)
+    {
+        if(vlakna == 1)
+            davka.nacitavac = vytvor_nacitavac(subory, pocet);
+        spusti_paralelne(pocet, vlakna, spracuj_bludisko, &davka);
+    }
+    else
+        fprintf(stderr, "Error, out of memory\n");
+    // nacitavac este moze citat subory, cesty sa uvolnia az po jeho ukonceni
+    free_nacitavac(davka.nacitavac);
+
+    for(int i = 0; i < pocet; i++)
+    {
+        if(davka.vysledky != NULL && davka.dlzky != NULL)
         {
-            if(horna_or_dolna_hranica == HORNA_HRANICA)
-            {
-                if(is_border(map, r, c, LAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOLAVA;
-                    c--;
-                }
-                else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, HORNA_HRANICA) == false)
-                {
-                    aktualny_smer = HORE;
-                    r--;
-                }
-                else if(is_border(map, r, c, LAVA_HRANICA) == true && is_border(map, r, c, HORNA_HRANICA) == true)
-                {
-                    aktualny_smer = DOPRAVA;
-                    c++;
-                }
-            }
-            else if(horna_or_dolna_hranica == DOLNA_HRANICA)
-            {
-                if(is_border(map, r, c, DOLNA_HRANICA) == false)
-                {
-                    aktualny_smer = DOLE;
-                    r++;
-                }
-                else if(is_border(map, r, c, DOLNA_HRANICA) == true && is_border(map, r, c, LAVA_HRANICA) == false)
-                {
-                    aktualny_smer = DOLAVA;
-                    c--;
-                }
-                else if(is_border(map, r, c, DOLNA_HRANICA) == true && is_border(map, r, c, LAVA_HRANICA) == true)
-                {
-                    aktualny_smer = DOPRAVA;
-                    c++;
-                }
-            }
+            printf("[%s]\n", subory[i]);
+            if(davka.vysledky[i] != NULL)
+                fwrite(davka.vysledky[i], 1, davka.dlzky[i], stdout);
+            else
+                printf("Error\n");
+            free(davka.vysledky[i]);
         }
+        free(subory[i]);
     }
+    free(subory);
+    free(davka.vysledky);
+    free(davka.dlzky);
+    return 0;
 }
-    
+
+#ifndef MAZE_NO_MAIN
 int main(int argc, char *argv[])
 {
+    bool hlasenie_pamate = false;
+    while(argc > 1 && (strcmp(argv[1], "--mem-report") == 0 || strcmp(argv[1], "--low-memory") == 0))
+    {
+        if(strcmp(argv[1], "--mem-report") == 0)
+        {
+            // opakovany prepinac nesmie hlasenie vypisat viackrat
+            if(!hlasenie_pamate)
+                atexit(vypis_spotrebu_pamate);
+            hlasenie_pamate = true;
+        }
+        else
+            nizka_spotreba_pamate = true;
+        argv++;
+        argc--;
+    }
+
     if(argc < 2)
     {
         fprintf(stderr, "Error, too few arguments. Use --help for further information\n");
         return 1;
     }
-    else if(argc > 5)
+    else if(argc > 7)
     {
         fprintf(stderr, "Error, too many arguments. Use --help for further information\n");
         return 1;
@@ -887,6 +3272,11 @@ int main(int argc, char *argv[])
     }
     else if(strcmp(argv[1], "--rpath") == 0)
     {
+        if(argc != 5 && !(argc == 7 && strcmp(argv[5], "--checkpoint") == 0))
+        {
+            fprintf(stderr, "Error, --rpath expects R C FILE [--checkpoint CKPT]. Use --help for further information\n");
+            return 1;
+        }
         int vstup_row = atoi(argv[2]) - 1;
         int vstup_col = atoi(argv[3]) - 1;
         char *subor_s_bludiskom = argv[4];
@@ -894,8 +3284,14 @@ int main(int argc, char *argv[])
 
         if(mapa != NULL)
         {
-            rpath_algoritmus(mapa, vstup_row, vstup_col);
+            int navrat = 0;
+            if(argc == 7)
+                navrat = zacni_prechod(mapa, RIGHT_PATH, vstup_row, vstup_col, subor_s_bludiskom, argv[6]);
+            else
+                rpath_algoritmus(mapa, vstup_row, vstup_col, stdout);
             free_map(mapa);
+            if(navrat != 0)
+                return navrat;
         }
         else
         {
@@ -905,6 +3301,11 @@ int main(int argc, char *argv[])
     }
     else if(strcmp(argv[1], "--lpath") == 0)
     {
+        if(argc != 5 && !(argc == 7 && strcmp(argv[5], "--checkpoint") == 0))
+        {
+            fprintf(stderr, "Error, --lpath expects R C FILE [--checkpoint CKPT]. Use --help for further information\n");
+            return 1;
+        }
         int vstup_row = atoi(argv[2]) - 1;
         int vstup_col = atoi(argv[3]) - 1;
         char *subor_s_bludiskom = argv[4];
@@ -912,14 +3313,271 @@ int main(int argc, char *argv[])
 
         if(mapa != NULL)
         {
-            lpath_algoritmus(mapa, vstup_row, vstup_col);
+            int navrat = 0;
+            if(argc == 7)
+                navrat = zacni_prechod(mapa, LEFT_PATH, vstup_row, vstup_col, subor_s_bludiskom, argv[6]);
+            else
+                lpath_algoritmus(mapa, vstup_row, vstup_col, stdout);
+            free_map(mapa);
+            if(navrat != 0)
+                return navrat;
+        }
+        else
+        {
+            fprintf(stderr, "Invalid\n");
+            return -1;
+        }
+    }
+    else if(strcmp(argv[1], "--resume") == 0)
+    {
+        if(argc != 3)
+        {
+            fprintf(stderr, "Error, --resume expects exactly one checkpoint file. Use --help for further information\n");
+            return 1;
+        }
+        return obnov_prechod(argv[2]);
+    }
+    else if(strcmp(argv[1], "--entrances") == 0)
+    {
+        if(argc != 3)
+        {
+            fprintf(stderr, "Error, --entrances expects exactly one file. Use --help for further information\n");
+            return 1;
+        }
+        Map *mapa = get_map(argv[2]);
+        if(mapa == NULL)
+        {
+            fprintf(stderr, "Invalid\n");
+            return -1;
+        }
+        vypis_vstupy(mapa, stdout);
+        free_map(mapa);
+    }
+    else if(strcmp(argv[1], "--goto") == 0)
+    {
+        if(argc != 7)
+        {
+            fprintf(stderr, "Error, --goto expects R1 C1 R2 C2 FILE. Use --help for further information\n");
+            return 1;
+        }
+        int start_row = atoi(argv[2]) - 1;
+        int start_col = atoi(argv[3]) - 1;
+        int ciel_row = atoi(argv[4]) - 1;
+        int ciel_col = atoi(argv[5]) - 1;
+        Map *mapa = get_map(argv[6]);
+        if(mapa == NULL || start_row < 0 || start_col < 0 || ciel_row < 0 || ciel_col < 0 ||
+           start_row >= mapa->rows || start_col >= mapa->cols || ciel_row >= mapa->rows || ciel_col >= mapa->cols)
+        {
+            if(mapa != NULL)
+                free_map(mapa);
+            fprintf(stderr, "Invalid\n");
+            return -1;
+        }
+
+        long expandovane;
+        if(nizka_spotreba_pamate)
+        {
+            int vysledok = cesta_s_malou_pamatou(mapa, start_row * mapa->cols + start_col, ciel_row * mapa->cols + ciel_col, &expandovane, stdout);
+            if(vysledok == 0)
+                printf("No Path\n");
+            if(vysledok == -1)
+                fprintf(stderr, "Error, out of memory\n");
+            else
+                fprintf(stderr, "expanded: %ld\n", expandovane);
+            free_map(mapa);
+            return vysledok == -1 ? 1 : 0;
+        }
+        int dlzka;
+        int *cesta = astar_cesta(mapa, start_row * mapa->cols + start_col, ciel_row * mapa->cols + ciel_col, true, &dlzka, &expandovane);
+        if(cesta == NULL)
+            printf("No Path\n");
+        for(int i = 0; cesta != NULL && i < dlzka; i++)
+            printf("%d,%d\n", cesta[i] / mapa->cols + 1, cesta[i] % mapa->cols + 1);
+        fprintf(stderr, "expanded: %ld\n", expandovane);
+        free(cesta);
+        free_map(mapa);
+    }
+    else if(strcmp(argv[1], "--prune") == 0)
+    {
+        if(argc != 4)
+        {
+            fprintf(stderr, "Error, --prune expects FILE OUT. Use --help for further information\n");
+            return 1;
+        }
+        Map *mapa = get_map(argv[2]);
+        if(mapa == NULL)
+        {
+            fprintf(stderr, "Invalid\n");
+            return -1;
+        }
+
+        int pocet_mrtvych;
+        unsigned char *mrtve = najdi_slepe_ulicky(mapa, &pocet_mrtvych);
+        if(mrtve == NULL)
+        {
+            fprintf(stderr, "Error, out of memory\n");
+            free_map(mapa);
+            return 1;
+        }
+        zamuruj_slepe_ulicky(mapa, mrtve);
+        bool ulozene = uloz_mapu(mapa, argv[3]);
+        if(ulozene)
+            printf("Pruned %d of %d cells\n", pocet_mrtvych, mapa->rows * mapa->cols);
+        else
+            fprintf(stderr, "Error, cannot write %s\n", argv[3]);
+        free(mrtve);
+        free_map(mapa);
+        if(!ulozene)
+            return 1;
+    }
+    else if(strcmp(argv[1], "--shortest") == 0)
+    {
+        if(argc != 5)
+        {
+            fprintf(stderr, "Error, --shortest expects R C FILE. Use --help for further information\n");
+            return 1;
+        }
+        int vstup_row = atoi(argv[2]) - 1;
+        int vstup_col = atoi(argv[3]) - 1;
+        Map *mapa = get_map(argv[4]);
+        if(mapa == NULL)
+        {
+            fprintf(stderr, "Invalid\n");
+            return -1;
+        }
+        if((entrance_direction(mapa, vstup_row, vstup_col, LEFT_PATH) == -1 && entrance_direction(mapa, vstup_row, vstup_col, RIGHT_PATH) == -1) ||
+           !vedie_von(mapa, vstup_row * mapa->cols + vstup_col))
+        {
+            printf("Invalid Entrance\n");
+            free_map(mapa);
+            return 0;
+        }
+
+        GrafKrizovatiek *graf = vytvor_graf_krizovatiek(mapa);
+        if(graf == NULL)
+        {
+            fprintf(stderr, "Error, out of memory\n");
             free_map(mapa);
+            return 1;
+        }
+        int dlzka;
+        int *cesta = najkratsia_cesta_von(mapa, graf, vstup_row * mapa->cols + vstup_col, &dlzka);
+        if(cesta == NULL)
+            printf("No Path\n");
+        for(int i = 0; cesta != NULL && i < dlzka; i++)
+            printf("%d,%d\n", cesta[i] / mapa->cols + 1, cesta[i] % mapa->cols + 1);
+        free(cesta);
+        free_graf(graf);
+        free_map(mapa);
+    }
+    else if(strcmp(argv[1], "--summary") == 0)
+    {
+        if(argc != 3)
+        {
+            fprintf(stderr, "Error, --summary expects exactly one file. Use --help for further information\n");
+            return 1;
+        }
+        Map *mapa = get_map(argv[2]);
+        if(mapa == NULL)
+        {
+            fprintf(stderr, "Invalid\n");
+            return -1;
+        }
+        bool v_poriadku = vypis_suhrn_vstupov(mapa, stdout);
+        if(!v_poriadku)
+            fprintf(stderr, "Error, out of memory\n");
+        free_map(mapa);
+        if(!v_poriadku)
+            return 1;
+    }
+    else if(strcmp(argv[1], "--render") == 0)
+    {
+        int leftright = -1;
+        if(argc == 7 && (strcmp(argv[4], "--rpath") == 0 || strcmp(argv[4], "--lpath") == 0))
+            leftright = strcmp(argv[4], "--rpath") == 0 ? RIGHT_PATH : LEFT_PATH;
+        else if(argc != 4)
+        {
+            fprintf(stderr, "Error, --render expects FILE OUT.ppm [--rpath R C | --lpath R C]. Use --help for further information\n");
+            return 1;
+        }
+        Map *mapa = get_map(argv[2]);
+        if(mapa == NULL)
+        {
+            fprintf(stderr, "Invalid\n");
+            return -1;
         }
+
+        unsigned char *cesta = NULL;
+        int pocet_na_ceste = 0;
+        if(leftright != -1)
+        {
+            cesta = oznac_cestu(mapa, atoi(argv[5]) - 1, atoi(argv[6]) - 1, leftright, &pocet_na_ceste);
+            if(cesta == NULL)
+                printf("Invalid Entrance\n");
+        }
+        int sirka, vyska;
+        bool vykreslene = vykresli_bludisko(mapa, argv[3], cesta, &sirka, &vyska);
+        if(vykreslene)
+            printf("Rendered %dx%d pixels, path %d cells\n", sirka, vyska, pocet_na_ceste);
         else
+            fprintf(stderr, "Error, cannot write %s\n", argv[3]);
+        if(cesta != NULL)
+            zapocitaj_pamat(PAMAT_RIESIC, -(long long)(mapa->rows * mapa->cols / 8 + 1));
+        free(cesta);
+        free_map(mapa);
+        if(!vykreslene)
+            return 1;
+    }
+    else if(strcmp(argv[1], "--junctions") == 0)
+    {
+        if(argc != 3)
+        {
+            fprintf(stderr, "Error, --junctions expects exactly one file. Use --help for further information\n");
+            return 1;
+        }
+        Map *mapa = get_map(argv[2]);
+        if(mapa == NULL)
         {
             fprintf(stderr, "Invalid\n");
             return -1;
         }
+        GrafKrizovatiek *graf = vytvor_graf_krizovatiek(mapa);
+        if(graf == NULL)
+        {
+            fprintf(stderr, "Error, out of memory\n");
+            free_map(mapa);
+            return 1;
+        }
+        printf("cells %d junctions %d edges %d\n", mapa->rows * mapa->cols, graf->pocet_uzlov, graf->pocet_hran);
+        free_graf(graf);
+        free_map(mapa);
+    }
+    else if(strcmp(argv[1], "--dir") == 0)
+    {
+        PRIKAZ prikaz;
+        int ocakavany_pocet = 4;
+        if(argc < 3)
+            argc = 0;
+        else if(strcmp(argv[2], "--test") == 0)
+            prikaz = PRIKAZ_TEST;
+        else if(strcmp(argv[2], "--entrances") == 0)
+            prikaz = PRIKAZ_VSTUPY;
+        else if(strcmp(argv[2], "--rpath") == 0 || strcmp(argv[2], "--lpath") == 0)
+        {
+            prikaz = strcmp(argv[2], "--rpath") == 0 ? PRIKAZ_RPATH : PRIKAZ_LPATH;
+            ocakavany_pocet = 6;
+        }
+        else
+            argc = 0;
+
+        if(argc != ocakavany_pocet)
+        {
+            fprintf(stderr, "Error, invalid --dir arguments. Use --help for further information\n");
+            return 1;
+        }
+        if(ocakavany_pocet == 6)
+            return spracuj_adresar(argv[5], prikaz, atoi(argv[3]) - 1, atoi(argv[4]) - 1);
+        return spracuj_adresar(argv[3], prikaz, 0, 0);
     }
     else
     {
@@ -927,4 +3585,5 @@ int main(int argc, char *argv[])
         return -1;
     }
     return 0;
-}
\ No newline at end of file
+}
+#endif
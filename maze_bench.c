@@ -0,0 +1,343 @@
+/**
+ * @brief Mikrobenchmark krokov algoritmov pravej/lavej ruky
+ *
+ * Vygeneruje v pamati dlhu chodbu a bludisko s hustymi sluckami a meria, kolko
+ * krokov za sekundu zvladne rpath_krok/lpath_krok bez akehokolvek vypisu.
+ * Ak je dostupne perf_event_open, vypise aj podiel chybnych predikcii skokov a cache miss.
+ * Na rovnakych bludiskach porovna aj pocet expandovanych policok A* a prehladavania do sirky.
+ *
+ * S prepinacom --load porovna nacitanie vsetkych bludisk v adresari cez get_map
+ * a cez NacitavacBludisk, pred kazdym behom vyhodi subory z page cache.
+ *
+ * Pouzitie: ./maze-bench [KROKY]
+ *           ./maze-bench --load DIR
+ */
+#define _GNU_SOURCE
+#define MAZE_NO_MAIN
+#include "maze.c"
+
+#include <stdint.h>
+#include <time.h>
+#include <unistd.h>
+#include <fcntl.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <linux/perf_event.h>
+
+#define BENCH_RADY 2000
+#define BENCH_STLPCE 2000
+#define BENCH_KROKY 20000000LL
+
+typedef int (*KrokFunkcia)(Map *map, int *r, int *c, int aktualny_smer);
+
+typedef enum
+{
+    SKOKY,
+    CHYBNE_SKOKY,
+    CACHE_PRISTUPY,
+    CACHE_MISS,
+    POCET_COUNTEROV,
+} COUNTER;
+
+typedef struct
+{
+    int fd[POCET_COUNTEROV];
+    bool dostupne;
+} PerfCountery;
+
+/**
+ * @brief Vygeneruje hadovitu chodbu cez cele bludisko
+ *
+ * Vstup je lavou stenou policka 2,1, chodba ide po radoch tam a spat a konci slepou ulickou
+ *
+ * @param rady pocet riadkov
+ * @param stlpce pocet stlpcov, musi byt parny, aby sa rady spajali na krajoch
+ *
+ * @return Vracia ukazatel na strukturu Map s vygenerovanou chodbou
+ */
+static Map *vygeneruj_chodbu(int rady, int stlpce)
+{
+    Map *map = inicialize_map(rady, stlpce);
+    memset(map->cells, 4, rady * stlpce);
+    for(int r = 0; r < rady; r++)
+    {
+        postav_stenu(map, r, 0, LAVA_HRANICA);
+        postav_stenu(map, r, stlpce - 1, PRAVA_HRANICA);
+        if(r < rady - 1)
+        {
+            int spoj = (r % 2 == 0) ? stlpce - 1 : 0;
+            map->cells[r * stlpce + spoj] &= ~4;
+            map->cells[(r + 1) * stlpce + spoj] &= ~4;
+        }
+    }
+    map->cells[stlpce] &= ~1;
+    return map;
+}
+
+/**
+ * @brief Vygeneruje bludisko s nahodnymi stenami a vela sluckami
+ *
+ * Kazda vnutorna stena vznikne s pravdepodobnostou 1/4, okraj je uzavrety okrem vstupu lavou stenou policka 2,1
+ *
+ * @param rady pocet riadkov
+ * @param stlpce pocet stlpcov
+ * @param seed seed generatora, aby bol beh reprodukovatelny
+ *
+ * @return Vracia ukazatel na strukturu Map s vygenerovanym bludiskom
+ */
+static Map *vygeneruj_slucky(int rady, int stlpce, uint64_t seed)
+{
+    Map *map = inicialize_map(rady, stlpce);
+    memset(map->cells, 0, rady * stlpce);
+    for(int r = 0; r < rady; r++)
+    {
+        for(int c = 0; c < stlpce; c++)
+        {
+            seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+            int nahoda = (int)(seed >> 58);
+            if(c == 0)
+                postav_stenu(map, r, c, LAVA_HRANICA);
+            if(c == stlpce - 1 || (nahoda & 3) == 0)
+                postav_stenu(map, r, c, PRAVA_HRANICA);
+            int horna_or_dolna_hranica = horna_dolna_hranica(r, c);
+            if((horna_or_dolna_hranica == HORNA_HRANICA && r == 0) || (horna_or_dolna_hranica == DOLNA_HRANICA && (r == rady - 1 || (nahoda & 12) == 0)))
+                postav_stenu(map, r, c, horna_or_dolna_hranica);
+        }
+    }
+    map->cells[stlpce] &= ~1;
+    return map;
+}
+
+static void otvor_countery(PerfCountery *countery)
+{
+    static const unsigned long long konfiguracia[POCET_COUNTEROV] = {
+        PERF_COUNT_HW_BRANCH_INSTRUCTIONS,
+        PERF_COUNT_HW_BRANCH_MISSES,
+        PERF_COUNT_HW_CACHE_REFERENCES,
+        PERF_COUNT_HW_CACHE_MISSES,
+    };
+
+    countery->dostupne = true;
+    for(int i = 0; i < POCET_COUNTEROV; i++)
+    {
+        struct perf_event_attr atributy;
+        memset(&atributy, 0, sizeof(atributy));
+        atributy.type = PERF_TYPE_HARDWARE;
+        atributy.size = sizeof(atributy);
+        atributy.config = konfiguracia[i];
+        atributy.disabled = 1;
+        atributy.exclude_kernel = 1;
+        atributy.exclude_hv = 1;
+        countery->fd[i] = (int)syscall(SYS_perf_event_open, &atributy, 0, -1, -1, 0);
+        if(countery->fd[i] == -1)
+            countery->dostupne = false;
+    }
+}
+
+static void zatvor_countery(PerfCountery *countery)
+{
+    for(int i = 0; i < POCET_COUNTEROV; i++)
+    {
+        if(countery->fd[i] != -1)
+            close(countery->fd[i]);
+    }
+}
+
+static void spusti_countery(PerfCountery *countery, bool spustit)
+{
+    if(!countery->dostupne)
+        return;
+    for(int i = 0; i < POCET_COUNTEROV; i++)
+    {
+        if(spustit)
+        {
+            ioctl(countery->fd[i], PERF_EVENT_IOC_RESET, 0);
+            ioctl(countery->fd[i], PERF_EVENT_IOC_ENABLE, 0);
+        }
+        else
+            ioctl(countery->fd[i], PERF_EVENT_IOC_DISABLE, 0);
+    }
+}
+
+static double cas_sekundy(void)
+{
+    struct timespec cas;
+    clock_gettime(CLOCK_MONOTONIC, &cas);
+    return cas.tv_sec + cas.tv_nsec * 1e-9;
+}
+
+/**
+ * @brief Spravi presne `kroky` krokov algoritmu od vstupu 2,1
+ *
+ * Ked algoritmus z bludiska vyjde, zacne znova od vstupu, takze pocet krokov nezavisi od tvaru bludiska
+ *
+ * @return Vracia kontrolny sucet pozicii, aby kompilator slucku nevyhodil
+ */
+static long long behaj(Map *map, KrokFunkcia krok, int leftright, long long kroky)
+{
+    int pociatocny_smer = start_direction(map, 1, 0, leftright);
+    int r = 1, c = 0, aktualny_smer = pociatocny_smer;
+    long long kontrolny_sucet = 0;
+    for(long long i = 0; i < kroky; i++)
+    {
+        aktualny_smer = krok(map, &r, &c, aktualny_smer);
+        if(r < 0 || c < 0 || r >= map->rows || c >= map->cols)
+        {
+            r = 1;
+            c = 0;
+            aktualny_smer = pociatocny_smer;
+        }
+        kontrolny_sucet += r ^ c;
+    }
+    return kontrolny_sucet;
+}
+
+static void zmeraj(const char *nazov, Map *map, KrokFunkcia krok, int leftright, long long kroky, PerfCountery *countery)
+{
+    long long hodnoty[POCET_COUNTEROV] = {0};
+    if(start_direction(map, 1, 0, leftright) == -1)
+    {
+        printf("  %-6s Invalid Entrance\n", nazov);
+        return;
+    }
+
+    spusti_countery(countery, true);
+    double zaciatok = cas_sekundy();
+    long long kontrolny_sucet = behaj(map, krok, leftright, kroky);
+    double trvanie = cas_sekundy() - zaciatok;
+    spusti_countery(countery, false);
+
+    printf("  %-6s %8.2f ns/step %8.1f Msteps/s", nazov, trvanie * 1e9 / kroky, kroky / trvanie / 1e6);
+    if(countery->dostupne)
+    {
+        for(int i = 0; i < POCET_COUNTEROV; i++)
+        {
+            if(read(countery->fd[i], &hodnoty[i], sizeof(hodnoty[i])) != sizeof(hodnoty[i]))
+                hodnoty[i] = 0;
+        }
+        printf("  branch-miss %5.2f%% (%.3f/step)  cache-miss %5.2f%% (%.4f/step)",
+               hodnoty[SKOKY] ? 100.0 * hodnoty[CHYBNE_SKOKY] / hodnoty[SKOKY] : 0.0, (double)hodnoty[CHYBNE_SKOKY] / kroky,
+               hodnoty[CACHE_PRISTUPY] ? 100.0 * hodnoty[CACHE_MISS] / hodnoty[CACHE_PRISTUPY] : 0.0, (double)hodnoty[CACHE_MISS] / kroky);
+    }
+    printf("  [checksum %lld]\n", kontrolny_sucet);
+}
+
+/**
+ * @brief Porovna A* s prehladavanim do sirky na ceste zo vstupu 2,1 do stredu bludiska
+ */
+static void porovnaj_goto(Map *map)
+{
+    const char *nazvy[] = {"bfs", "astar"};
+    int ciel = (map->rows / 2) * map->cols + map->cols / 2;
+    for(int s_heuristikou = 0; s_heuristikou < 2; s_heuristikou++)
+    {
+        int dlzka;
+        long expandovane;
+        double zaciatok = cas_sekundy();
+        int *cesta = astar_cesta(map, map->cols, ciel, s_heuristikou, &dlzka, &expandovane);
+        double trvanie = cas_sekundy() - zaciatok;
+        printf("  %-6s %8.2f ms  expanded %ld  path %d\n", nazvy[s_heuristikou], trvanie * 1e3, expandovane, cesta != NULL ? dlzka : -1);
+        free(cesta);
+    }
+}
+
+/**
+ * @brief Vyhodi subory z page cache, aby sa dalsi beh citania zacal zo studenej cache
+ */
+static void vyhod_z_cache(char **subory, int pocet)
+{
+    for(int i = 0; i < pocet; i++)
+    {
+        int fd = open(subory[i], O_RDONLY);
+        if(fd == -1)
+            continue;
+        fdatasync(fd);
+        posix_fadvise(fd, 0, 0, POSIX_FADV_DONTNEED);
+        close(fd);
+    }
+}
+
+/**
+ * @brief Porovna postupne nacitanie cez get_map s nacitanim cez NacitavacBludisk
+ */
+static int zmeraj_nacitanie(const char *adresar)
+{
+    int pocet;
+    char **subory = najdi_bludiska(adresar, &pocet);
+    if(subory == NULL)
+    {
+        fprintf(stderr, "Error, cannot read directory %s\n", adresar);
+        return 1;
+    }
+
+    long long bajty = 0;
+    for(int i = 0; i < pocet; i++)
+    {
+        struct stat informacie;
+        if(stat(subory[i], &informacie) == 0)
+            bajty += informacie.st_size;
+    }
+    printf("loading %d mazes, %.1f MB, cold cache\n", pocet, bajty / 1e6);
+
+    for(int pipeline = 0; pipeline < 2; pipeline++)
+    {
+        vyhod_z_cache(subory, pocet);
+        int platne = 0;
+        double zaciatok = cas_sekundy();
+        NacitavacBludisk *nacitavac = pipeline ? vytvor_nacitavac(subory, pocet) : NULL;
+        for(int i = 0; i < pocet; i++)
+        {
+            Map *mapa = nacitavac != NULL ? nacitavac_dalsia(nacitavac) : get_map(subory[i]);
+            if(mapa != NULL)
+            {
+                platne++;
+                free_map(mapa);
+            }
+        }
+        free_nacitavac(nacitavac);
+        double trvanie = cas_sekundy() - zaciatok;
+        printf("  %-9s %8.2f ms %9.1f files/s %8.1f MB/s  valid %d\n", pipeline ? "readahead" : "get_map",
+               trvanie * 1e3, pocet / trvanie, bajty / trvanie / 1e6, platne);
+    }
+
+    for(int i = 0; i < pocet; i++)
+        free(subory[i]);
+    free(subory);
+    return 0;
+}
+
+int main(int argc, char *argv[])
+{
+    long long kroky = BENCH_KROKY;
+    if(argc > 2 && strcmp(argv[1], "--load") == 0)
+        return zmeraj_nacitanie(argv[2]);
+    if(argc > 1)
+        kroky = atoll(argv[1]);
+    if(kroky < 1)
+    {
+        fprintf(stderr, "Error, invalid step count\n");
+        return 1;
+    }
+
+    PerfCountery countery;
+    otvor_countery(&countery);
+    if(!countery.dostupne)
+        printf("perf counters unavailable, reporting time only\n");
+
+    Map *chodba = vygeneruj_chodbu(BENCH_RADY, BENCH_STLPCE);
+    printf("corridor %dx%d, %lld steps\n", BENCH_RADY, BENCH_STLPCE, kroky);
+    zmeraj("rpath", chodba, rpath_krok, RIGHT_PATH, kroky, &countery);
+    zmeraj("lpath", chodba, lpath_krok, LEFT_PATH, kroky, &countery);
+    porovnaj_goto(chodba);
+    free_map(chodba);
+
+    Map *slucky = vygeneruj_slucky(BENCH_RADY, BENCH_STLPCE, 2023);
+    printf("dense loops %dx%d, %lld steps\n", BENCH_RADY, BENCH_STLPCE, kroky);
+    zmeraj("rpath", slucky, rpath_krok, RIGHT_PATH, kroky, &countery);
+    zmeraj("lpath", slucky, lpath_krok, LEFT_PATH, kroky, &countery);
+    porovnaj_goto(slucky);
+    free_map(slucky);
+
+    zatvor_countery(&countery);
+    return 0;
+}
@@ -0,0 +1,418 @@
+/**
+ * @brief Diferencialne testy alternativnych algoritmov proti rpath_algoritmus/lpath_algoritmus
+ *
+ * Generuje nahodne platne bludiska s nahodnymi otvormi na okraji. Pre kazde okrajove policko,
+ * obe ruky a niekolko nahodnych (aj neplatnych) vstupov porovna vystup kazdeho algoritmu
+ * zo zoznamu MOTORY bajt po bajte s referencnymi algoritmami, vratane "Invalid Entrance".
+ * Vstupy, z ktorych sa referencny algoritmus zacykli, sa preskocia, lebo by nikdy neskoncili.
+ *
+ * Pouzitie: ./maze-diff [ITERACIE] [SEED]
+ */
+#define MAZE_NO_MAIN
+#include "maze.c"
+
+#include <stdint.h>
+
+#define DIFF_ITERACIE 2000
+#define DIFF_MAX_ROZMER 12
+#define DIFF_NAHODNE_VSTUPY 4
+
+typedef void (*Motor)(Map *map, int r, int c, int leftright, FILE *vystup);
+
+typedef struct
+{
+    const char *nazov;
+    Motor motor;
+} PopisMotora;
+
+typedef struct
+{
+    int r;
+    int c;
+    int leftright;
+} Vstup;
+
+typedef struct
+{
+    Map *map;
+    Vstup *vstupy;
+    char **vysledky;
+    size_t *dlzky;
+} DavkaVstupov;
+
+static uint64_t stav_generatora;
+
+static int nahodne(int rozsah)
+{
+    stav_generatora = stav_generatora * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (int)((stav_generatora >> 33) % (uint64_t)rozsah);
+}
+
+static void referencia(Map *map, int r, int c, int leftright, FILE *vystup)
+{
+    if(leftright == RIGHT_PATH)
+        rpath_algoritmus(map, r, c, vystup);
+    else
+        lpath_algoritmus(map, r, c, vystup);
+}
+
+/**
+ * @brief Referencny algoritmus bez tabulky vstupov, smer sa pocita cez start_direction
+ */
+static void bez_tabulky(Map *map, int r, int c, int leftright, FILE *vystup)
+{
+    signed char *vstupy = map->vstupy;
+    map->vstupy = NULL;
+    referencia(map, r, c, leftright, vystup);
+    map->vstupy = vstupy;
+}
+
+/**
+ * @brief Zapise mapu do pamate a znova ju nacita, volitelne do zbalenej podoby
+ *
+ * @return Vracia novu mapu alebo NULL, ak ju parser neprijal
+ */
+static Map *kopia_mapy(Map *map, bool zbalena)
+{
+    char *text = NULL;
+    size_t dlzka = 0;
+    FILE *zapis = open_memstream(&text, &dlzka);
+    zapis_mapu(map, zapis);
+    fclose(zapis);
+
+    FILE *citanie = fmemopen(text, dlzka, "r");
+    Map *kopia = nacitaj_mapu_v_tvare(citanie, zbalena);
+    fclose(citanie);
+    free(text);
+    return kopia;
+}
+
+/**
+ * @brief Spusti referencny algoritmus nad kopiou mapy z kopia_mapy
+ */
+static void referencia_nad_kopiou(Map *map, int r, int c, int leftright, FILE *vystup, bool zbalena)
+{
+    Map *kopia = kopia_mapy(map, zbalena);
+    if(kopia == NULL)
+    {
+        fprintf(vystup, "Invalid\n");
+        return;
+    }
+    referencia(kopia, r, c, leftright, vystup);
+    free_map(kopia);
+}
+
+/**
+ * @brief Referencny algoritmus nad mapou, ktora sa zapise a znova nacita cez nacitaj_mapu
+ */
+static void znovu_nacitana(Map *map, int r, int c, int leftright, FILE *vystup)
+{
+    referencia_nad_kopiou(map, r, c, leftright, vystup, false);
+}
+
+/**
+ * @brief Referencny algoritmus nad mapou znova nacitanou do zbalenej podoby, 3 bity na policko
+ */
+static void zbalena(Map *map, int r, int c, int leftright, FILE *vystup)
+{
+    referencia_nad_kopiou(map, r, c, leftright, vystup, true);
+}
+
+/**
+ * @brief Porovna cestu z cesta_s_malou_pamatou nad zbalenou mapou s dlzkou cesty z astar_cesta
+ *
+ * Najkratsich ciest moze byt viac, preto sa kontroluje dlzka a to, ze kazdy krok ide cez otvorenu stenu
+ *
+ * @return Vracia true, ak sa vysledky zhoduju
+ */
+static bool over_malu_pamat(Map *map, int start, int ciel)
+{
+    int dlzka;
+    long expandovane;
+    int *cesta = astar_cesta(map, start, ciel, true, &dlzka, &expandovane);
+    free(cesta);
+
+    Map *kopia = kopia_mapy(map, true);
+    char *text = NULL;
+    size_t velkost = 0;
+    FILE *vystup = open_memstream(&text, &velkost);
+    int vysledok = cesta_s_malou_pamatou(kopia, start, ciel, &expandovane, vystup);
+    fclose(vystup);
+    free_map(kopia);
+
+    bool zhoda = vysledok == (cesta != NULL ? 1 : 0);
+    int pocet = 0, predosle = -1, r, c;
+    for(char *riadok = text; zhoda && *riadok != '\0'; riadok = strchr(riadok, '\n') + 1, pocet++)
+    {
+        sscanf(riadok, "%d,%d", &r, &c);
+        int policko = (r - 1) * map->cols + c - 1, susedia[3];
+        int pocet_susedov = predosle == -1 ? 0 : otvoreni_susedia(map, predosle, susedia);
+        bool sused = predosle == -1 ? policko == start : false;
+        for(int i = 0; i < pocet_susedov; i++)
+            sused = sused || susedia[i] == policko;
+        zhoda = sused;
+        predosle = policko;
+    }
+    zhoda = zhoda && (cesta == NULL || (pocet == dlzka && predosle == ciel));
+    if(!zhoda)
+    {
+        fprintf(stderr, "MISMATCH low-memory goto %d %d %d %d on maze:\n", start / map->cols + 1, start % map->cols + 1, ciel / map->cols + 1, ciel % map->cols + 1);
+        zapis_mapu(map, stderr);
+        fprintf(stderr, "--- expected length %d\n--- got\n%s", cesta != NULL ? dlzka : 0, text);
+    }
+    free(text);
+    return zhoda;
+}
+
+static char cesta_checkpointu[64];
+
+/**
+ * @brief Prechod, ktory sa po par krokoch "preruse" a pokracuje zo suboru so stavom
+ *
+ * Vystup sa po preruseni skrati na ulozeny posun rovnako, ako to robi --resume s obycajnym suborom
+ */
+static void obnoveny(Map *map, int r, int c, int leftright, FILE *vystup)
+{
+    int aktualny_smer = entrance_direction(map, r, c, leftright);
+    if(aktualny_smer == -1)
+    {
+        fprintf(vystup, "Invalid Entrance\n");
+        return;
+    }
+
+    char *text = NULL;
+    size_t dlzka = 0;
+    FILE *prvy_beh = open_memstream(&text, &dlzka);
+    remove(cesta_checkpointu);
+    StavPrechodu stav = {leftright, r, c, aktualny_smer, 0, 0, ""};
+    long long interval = 1 + nahodne(4);
+    int vysledok = prechod_s_checkpointom(map, &stav, cesta_checkpointu, interval, nahodne(4 * map->rows * map->cols), prvy_beh);
+    fclose(prvy_beh);
+    if(vysledok == 0)
+    {
+        fwrite(text, 1, dlzka, vystup);
+        free(text);
+        return;
+    }
+
+    // prerusenie pred prvym ulozenim stavu, prechod zacne odznova
+    if(!nacitaj_checkpoint(cesta_checkpointu, &stav))
+        stav = (StavPrechodu){leftright, r, c, aktualny_smer, 0, 0, ""};
+    fwrite(text, 1, stav.posun, vystup);
+    free(text);
+    prechod_s_checkpointom(map, &stav, cesta_checkpointu, interval, -1, vystup);
+}
+
+static TabulkaSkokov *tabulky_skokov[2];
+
+/**
+ * @brief Prechod cez tabulku skokov, kazde policko sa najde skokom o i krokov od vstupu
+ */
+static void skokmi(Map *map, int r, int c, int leftright, FILE *vystup)
+{
+    int aktualny_smer = entrance_direction(map, r, c, leftright);
+    if(aktualny_smer == -1)
+    {
+        fprintf(vystup, "Invalid Entrance\n");
+        return;
+    }
+
+    int start = 4 * (r * map->cols + c) + aktualny_smer, vychod;
+    long long dlzka = dlzka_prechodu(tabulky_skokov[leftright], start, &vychod);
+    for(long long i = 0; i < dlzka; i++)
+    {
+        int policko = skoc_o(tabulky_skokov[leftright], start, i) / 4;
+        fprintf(vystup, "%d,%d\n", policko / map->cols + 1, policko % map->cols + 1);
+    }
+    if(dlzka == -1)
+        fprintf(vystup, "loop\n");
+}
+
+static const PopisMotora MOTORY[] = {
+    {"no-table", bez_tabulky},
+    {"reparsed", znovu_nacitana},
+    {"resumed", obnoveny},
+    {"jump-table", skokmi},
+    {"packed", zbalena},
+};
+
+/**
+ * @brief Vygeneruje nahodne platne bludisko a nacita ho tak, ako by ho nacitalo get_map
+ *
+ * @return Vracia mapu alebo NULL, ak vygenerovane bludisko parser neprijal
+ */
+static Map *vygeneruj_bludisko(void)
+{
+    int rady = 1 + nahodne(DIFF_MAX_ROZMER);
+    int stlpce = 1 + nahodne(DIFF_MAX_ROZMER);
+    Map *map = inicialize_map(rady, stlpce);
+    memset(map->cells, 0, rady * stlpce);
+    for(int r = 0; r < rady; r++)
+    {
+        for(int c = 0; c < stlpce; c++)
+        {
+            int horna_or_dolna_hranica = horna_dolna_hranica(r, c);
+            bool okraj_hranice = (horna_or_dolna_hranica == HORNA_HRANICA && r == 0) || (horna_or_dolna_hranica == DOLNA_HRANICA && r == rady - 1);
+            if((c == 0 && nahodne(4) != 0) || (c > 0 && nahodne(2) == 0))
+                postav_stenu(map, r, c, LAVA_HRANICA);
+            if(c == stlpce - 1 && nahodne(4) != 0)
+                postav_stenu(map, r, c, PRAVA_HRANICA);
+            if((okraj_hranice && nahodne(4) != 0) || (!okraj_hranice && horna_or_dolna_hranica == DOLNA_HRANICA && nahodne(2) == 0))
+                postav_stenu(map, r, c, horna_or_dolna_hranica);
+        }
+    }
+
+    Map *nacitana = kopia_mapy(map, false);
+    free_map(map);
+    return nacitana;
+}
+
+/**
+ * @brief Zisti, ci by sa referencny algoritmus z daneho vstupu zacyklil
+ *
+ * Stav algoritmu je policko a smer, takze ak nevyjde do 4 * pocet policok krokov, uz nevyjde nikdy
+ */
+static bool zacykli_sa(Map *map, Vstup vstup)
+{
+    int r = vstup.r, c = vstup.c;
+    int aktualny_smer = entrance_direction(map, r, c, vstup.leftright);
+    if(aktualny_smer == -1)
+        return false;
+
+    long long limit = 4LL * map->rows * map->cols + 1;
+    for(long long i = 0; i < limit; i++)
+    {
+        aktualny_smer = krok(map, &r, &c, aktualny_smer, vstup.leftright);
+        if(r < 0 || c < 0 || r >= map->rows || c >= map->cols)
+            return false;
+    }
+    return true;
+}
+
+static char *spusti_motor(Motor motor, Map *map, Vstup vstup, size_t *dlzka)
+{
+    char *text = NULL;
+    FILE *vystup = open_memstream(&text, dlzka);
+    motor(map, vstup.r, vstup.c, vstup.leftright, vystup);
+    fclose(vystup);
+    return text;
+}
+
+static void spusti_referenciu(int index, void *kontext)
+{
+    DavkaVstupov *davka = (DavkaVstupov*)kontext;
+    davka->vysledky[index] = spusti_motor(referencia, davka->map, davka->vstupy[index], &davka->dlzky[index]);
+}
+
+static void vypis_rozdiel(const char *nazov, Map *map, Vstup vstup, const char *ocakavane, const char *skutocne)
+{
+    fprintf(stderr, "MISMATCH engine %s, %s %d %d on maze:\n", nazov, vstup.leftright == RIGHT_PATH ? "--rpath" : "--lpath", vstup.r + 1, vstup.c + 1);
+    zapis_mapu(map, stderr);
+    fprintf(stderr, "--- expected\n%s--- got\n%s", ocakavane, skutocne);
+}
+
+int main(int argc, char *argv[])
+{
+    int iteracie = argc > 1 ? atoi(argv[1]) : DIFF_ITERACIE;
+    stav_generatora = argc > 2 ? strtoull(argv[2], NULL, 10) : 1;
+    long long porovnania = 0, preskocene = 0, neplatne_vstupy = 0;
+    snprintf(cesta_checkpointu, sizeof(cesta_checkpointu), "%s/maze-diff-%ld.ckpt", access("/dev/shm", W_OK) == 0 ? "/dev/shm" : "/tmp", (long)getpid());
+
+    for(int iteracia = 0; iteracia < iteracie; iteracia++)
+    {
+        Map *map = vygeneruj_bludisko();
+        if(map == NULL)
+        {
+            fprintf(stderr, "Error, generated maze rejected by the parser in iteration %d\n", iteracia);
+            return 1;
+        }
+
+        for(int leftright = LEFT_PATH; leftright <= RIGHT_PATH; leftright++)
+            tabulky_skokov[leftright] = vytvor_tabulku_skokov(map, leftright, 4);
+        for(int i = 0; i < DIFF_NAHODNE_VSTUPY; i++)
+        {
+            if(!over_malu_pamat(map, nahodne(map->rows * map->cols), nahodne(map->rows * map->cols)))
+            {
+                fprintf(stderr, "seed %s, iteration %d\n", argc > 2 ? argv[2] : "1", iteracia);
+                return 1;
+            }
+            porovnania++;
+        }
+
+        int max_vstupov = 2 * (pocet_okrajovych(map) + DIFF_NAHODNE_VSTUPY);
+        Vstup *vstupy = (Vstup*)malloc(max_vstupov * sizeof(Vstup));
+        int pocet_vstupov = 0;
+        for(int r = 0; r < map->rows; r++)
+        {
+            for(int c = 0; c < map->cols; c++)
+            {
+                if(okrajovy_index(map, r, c) == -1)
+                    continue;
+                for(int leftright = LEFT_PATH; leftright <= RIGHT_PATH; leftright++)
+                    vstupy[pocet_vstupov++] = (Vstup){r, c, leftright};
+            }
+        }
+        for(int i = 0; i < DIFF_NAHODNE_VSTUPY; i++)
+        {
+            Vstup vstup = {nahodne(map->rows + 4) - 2, nahodne(map->cols + 4) - 2, nahodne(2)};
+            // start_border_* cita mimo mapy pre posledny rad a stlpec mimo mapy, tabulka vstupov tam vracia -1
+            if(vstup.r == map->rows - 1 && (vstup.c < 0 || vstup.c >= map->cols))
+                continue;
+            vstupy[pocet_vstupov++] = vstup;
+        }
+
+        int platne = 0;
+        for(int i = 0; i < pocet_vstupov; i++)
+        {
+            if(zacykli_sa(map, vstupy[i]))
+                preskocene++;
+            else
+                vstupy[platne++] = vstupy[i];
+        }
+        pocet_vstupov = platne;
+
+        DavkaVstupov davka = {map, vstupy, (char**)calloc(pocet_vstupov + 1, sizeof(char*)), (size_t*)calloc(pocet_vstupov + 1, sizeof(size_t))};
+        spusti_paralelne(pocet_vstupov, 4, spusti_referenciu, &davka);
+
+        for(int i = 0; i < pocet_vstupov; i++)
+        {
+            size_t dlzka;
+            char *ocakavane = spusti_motor(referencia, map, vstupy[i], &dlzka);
+            if(strcmp(ocakavane, "Invalid Entrance\n") == 0)
+                neplatne_vstupy++;
+
+            bool zhoda = dlzka == davka.dlzky[i] && memcmp(ocakavane, davka.vysledky[i], dlzka) == 0;
+            if(!zhoda)
+                vypis_rozdiel("parallel", map, vstupy[i], ocakavane, davka.vysledky[i]);
+            for(size_t m = 0; zhoda && m < sizeof(MOTORY) / sizeof(MOTORY[0]); m++)
+            {
+                size_t dlzka_motora;
+                char *skutocne = spusti_motor(MOTORY[m].motor, map, vstupy[i], &dlzka_motora);
+                zhoda = dlzka == dlzka_motora && memcmp(ocakavane, skutocne, dlzka) == 0;
+                if(!zhoda)
+                    vypis_rozdiel(MOTORY[m].nazov, map, vstupy[i], ocakavane, skutocne);
+                free(skutocne);
+                porovnania++;
+            }
+            free(ocakavane);
+            if(!zhoda)
+            {
+                fprintf(stderr, "seed %s, iteration %d\n", argc > 2 ? argv[2] : "1", iteracia);
+                return 1;
+            }
+        }
+
+        for(int i = 0; i < pocet_vstupov; i++)
+            free(davka.vysledky[i]);
+        free(davka.vysledky);
+        free(davka.dlzky);
+        free(vstupy);
+        free_tabulka_skokov(tabulky_skokov[LEFT_PATH]);
+        free_tabulka_skokov(tabulky_skokov[RIGHT_PATH]);
+        free_map(map);
+    }
+
+    printf("maze-diff: %d mazes, %lld comparisons (%lld invalid entrances), %lld looping entrances skipped, all engines identical\n",
+           iteracie, porovnania, neplatne_vstupy, preskocene);
+    return 0;
+}
@@ -0,0 +1,127 @@
+/**
+ * @brief Fuzzovaci harness pre nacitanie mapy, kompatibilny s libFuzzer aj AFL
+ *
+ * Vstupy s viac ako FUZZ_MAX_POLICOK polickami v hlavicke sa preskocia.
+ * Vstup sa parsuje cez nacitaj_mapu rovnako ako v get_map. Ak je mapa platna, prejdu sa vsetky
+ * okrajove policka cez tabulku vstupov, zhoda so zbalenou mapou, obmedzeny pocet krokov oboch algoritmov,
+ * hladanie slepych uliciek a graf krizovatiek.
+ *
+ * libFuzzer: clang -fsanitize=fuzzer,address -DMAZE_LIBFUZZER maze_fuzz.c
+ * AFL a prehravanie: ./maze-fuzz [FILE...], bez argumentov cita stdin
+ */
+#define MAZE_NO_MAIN
+#include "maze.c"
+
+#include <stdint.h>
+
+#define FUZZ_MAX_POLICOK 1000000
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+static void prejdi_vstup(Map *map, int r, int c, int leftright)
+{
+    int aktualny_smer = entrance_direction(map, r, c, leftright);
+    if(aktualny_smer == -1)
+        return;
+
+    long long limit = 4LL * map->rows * map->cols + 1;
+    for(long long i = 0; i < limit && r > -1 && c > -1 && r < map->rows && c < map->cols; i++)
+        aktualny_smer = krok(map, &r, &c, aktualny_smer, leftright);
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    if(size == 0)
+        return 0;
+    FILE *subor = fmemopen((void*)data, size, "r");
+    if(subor == NULL)
+        return 0;
+    // velku hlavicku treba odmietnut skor, nez parser alokuje policka, inak by libFuzzer hlasil OOM
+    int rady, stlpce;
+    if(fscanf(subor, "%d %d", &rady, &stlpce) == 2 && (long long)rady * stlpce > FUZZ_MAX_POLICOK)
+    {
+        fclose(subor);
+        return 0;
+    }
+    rewind(subor);
+    Map *map = nacitaj_mapu(subor);
+    fclose(subor);
+
+    // zbalena mapa musi byt platna prave vtedy, ked obycajna, a mat rovnake policka
+    subor = fmemopen((void*)data, size, "r");
+    Map *zbalena = subor != NULL ? nacitaj_mapu_v_tvare(subor, true) : NULL;
+    if(subor != NULL)
+        fclose(subor);
+    if(subor != NULL && (map == NULL) != (zbalena == NULL))
+        abort();
+    for(long long i = 0; map != NULL && zbalena != NULL && i < (long long)map->rows * map->cols; i++)
+    {
+        if(bunka(map, i) != bunka(zbalena, i))
+            abort();
+    }
+    if(zbalena != NULL)
+        free_map(zbalena);
+    if(map == NULL)
+        return 0;
+
+    for(int r = 0; r < map->rows; r++)
+    {
+        for(int c = 0; c < map->cols; c++)
+        {
+            if(okrajovy_index(map, r, c) == -1)
+                continue;
+            prejdi_vstup(map, r, c, LEFT_PATH);
+            prejdi_vstup(map, r, c, RIGHT_PATH);
+        }
+    }
+
+    int pocet_mrtvych;
+    free(najdi_slepe_ulicky(map, &pocet_mrtvych));
+    free_graf(vytvor_graf_krizovatiek(map));
+    free_map(map);
+    return 0;
+}
+
+#ifndef MAZE_LIBFUZZER
+static void spusti_subor(FILE *subor)
+{
+    size_t kapacita = 4096, velkost = 0, precitane;
+    uint8_t *data = (uint8_t*)malloc(kapacita);
+    while(data != NULL && (precitane = fread(data + velkost, 1, kapacita - velkost, subor)) > 0)
+    {
+        velkost += precitane;
+        if(velkost == kapacita)
+        {
+            kapacita *= 2;
+            uint8_t *vacsie = (uint8_t*)realloc(data, kapacita);
+            if(vacsie == NULL)
+                break;
+            data = vacsie;
+        }
+    }
+    if(data != NULL)
+        LLVMFuzzerTestOneInput(data, velkost);
+    free(data);
+}
+
+int main(int argc, char *argv[])
+{
+    if(argc < 2)
+    {
+        spusti_subor(stdin);
+        return 0;
+    }
+    for(int i = 1; i < argc; i++)
+    {
+        FILE *subor = fopen(argv[i], "rb");
+        if(subor == NULL)
+        {
+            fprintf(stderr, "Error, cannot open %s\n", argv[i]);
+            return 1;
+        }
+        spusti_subor(subor);
+        fclose(subor);
+    }
+    return 0;
+}
+#endif
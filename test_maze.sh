@@ -52,6 +52,24 @@ run_test() {
     test_count=$((test_count + 1))
 }
 
+check_file() {
+    output_file=$1
+    expected_checksum=$2
+
+    echo -n -e "$test_count. Checking $output_file\n"
+
+    actual_checksum=$(cksum < $output_file)
+
+    if [[ "$actual_checksum" == "$expected_checksum" ]]; then
+        echo -e "${GREEN} [OK] ${NORMAL}"
+        correct=$((correct + 1))
+    else
+        echo -e "${RED}[FAIL]${NORMAL}"
+        echo "expected $expected_checksum, got $actual_checksum"
+    fi
+    test_count=$((test_count + 1))
+}
+
 # tests
 echo -e "6 7\n1 4 4 2 5 0 6\n1 4 4 0 4 0 2\n1 0 4 0 4 6 1\n1 2 7 1 0 4 2\n3 1 4 2 3 1 2\n4 2 5 0 4 2 5" > test_01.txt
 
@@ -519,6 +537,258 @@ echo -e "-6 -7\n1 4 4 2 5 0 6\n1 4 4 0 4 0 2\n1 0 4 0 4 6 1\n1 2 7 1 0 4 2\n3 1
 # 23
 run_test "test_11.txt" "--test" "Invalid"
 
+# entrance table
+# 24
+run_test "test_01.txt" "--entrances" "1,1 Valid lpath:- rpath:down
+1,2 Invalid lpath:- rpath:-
+1,3 Invalid lpath:- rpath:-
+1,4 Invalid lpath:- rpath:-
+1,5 Invalid lpath:- rpath:-
+1,6 Invalid lpath:- rpath:-
+1,7 Invalid lpath:- rpath:-
+2,1 Invalid lpath:- rpath:-
+2,7 Invalid lpath:- rpath:-
+3,1 Invalid lpath:- rpath:-
+3,7 Valid lpath:up rpath:left
+4,1 Invalid lpath:- rpath:-
+4,7 Invalid lpath:- rpath:-
+5,1 Invalid lpath:- rpath:-
+5,7 Invalid lpath:- rpath:-
+6,1 Valid lpath:right rpath:right
+6,2 Invalid lpath:- rpath:-
+6,3 Invalid lpath:- rpath:-
+6,4 Invalid lpath:- rpath:-
+6,5 Invalid lpath:- rpath:-
+6,6 Invalid lpath:- rpath:-
+6,7 Valid lpath:left rpath:down"
+
+# directory mode
+mkdir -p test_dir
+cp test_01.txt test_dir/a.txt
+cp test_11.txt test_dir/b.txt
+
+# 25
+run_test "test_dir" "--dir --rpath 6 7" "[test_dir/a.txt]
+6,7
+[test_dir/b.txt]
+Invalid"
+
+# A* to a given cell
+# 26
+run_test "test_01.txt" "--goto 3 7 1 1" "3,7
+2,7
+2,6
+2,5
+2,4
+1,4
+1,3
+1,2
+1,1"
+
+# dead-end pruning
+# 27
+run_test "test_01.txt test_pruned.txt" "--prune" "Pruned 10 of 42 cells"
+
+# 28
+run_test "test_pruned.txt" "--lpath 6 1" "6,1
+6,2
+5,2
+5,3
+5,4
+6,4
+6,5
+6,6
+5,6
+5,7
+4,7
+4,6
+4,5
+4,4
+3,4
+3,3
+3,2
+3,1
+2,1
+2,2
+2,3
+2,4
+1,4
+1,3
+1,2
+1,1"
+
+# junction graph
+# 29
+run_test "test_01.txt" "--junctions" "cells 42 junctions 18 edges 30"
+
+# 30
+run_test "test_01.txt" "--shortest 3 7" "3,7
+2,7
+2,6
+2,5
+2,4
+1,4
+1,3
+1,2
+1,1"
+
+# checkpoint and resume
+# 31
+export MAZE_CHECKPOINT_STEPS=4
+run_test "test_01.txt --checkpoint test_ckpt.txt" "--lpath 3 7" "3,7
+2,7
+2,6
+2,5
+2,4
+2,3
+2,2
+2,1
+3,1
+3,2
+3,3
+3,4
+3,5
+3,6
+3,5
+3,4
+4,4
+4,5
+4,6
+4,7
+5,7
+5,6
+6,6
+6,5
+6,4
+6,3
+6,4
+5,4
+5,3
+5,2
+6,2
+6,1"
+unset MAZE_CHECKPOINT_STEPS
+
+# 32
+echo -e "MAZE-CHECKPOINT 1\n1 4 5 1 10 40\ntest_01.txt" > test_ckpt.txt
+run_test "test_ckpt.txt" "--resume" "5,6
+5,7
+4,7
+4,6
+4,5
+4,4
+3,4
+3,5
+3,6
+3,5
+3,4
+3,3
+3,2
+3,1
+2,1
+2,2
+2,3
+2,4
+2,5
+2,6
+2,7
+3,7"
+
+# jump table summary
+# 33
+run_test "test_01.txt" "--summary" "1,1 lpath:- rpath:6,1/34
+1,2 lpath:- rpath:-
+1,3 lpath:- rpath:-
+1,4 lpath:- rpath:-
+1,5 lpath:- rpath:-
+1,6 lpath:- rpath:-
+1,7 lpath:- rpath:-
+2,1 lpath:- rpath:-
+2,7 lpath:- rpath:-
+3,1 lpath:- rpath:-
+3,7 lpath:6,1/32 rpath:1,1/15
+4,1 lpath:- rpath:-
+4,7 lpath:- rpath:-
+5,1 lpath:- rpath:-
+5,7 lpath:- rpath:-
+6,1 lpath:1,1/34 rpath:3,7/32
+6,2 lpath:- rpath:-
+6,3 lpath:- rpath:-
+6,4 lpath:- rpath:-
+6,5 lpath:- rpath:-
+6,6 lpath:- rpath:-
+6,7 lpath:6,7/1 rpath:6,7/1"
+
+# low-memory mode
+# 34
+run_test "test_01.txt" "--low-memory --lpath 3 7" "3,7
+2,7
+2,6
+2,5
+2,4
+2,3
+2,2
+2,1
+3,1
+3,2
+3,3
+3,4
+3,5
+3,6
+3,5
+3,4
+4,4
+4,5
+4,6
+4,7
+5,7
+5,6
+6,6
+6,5
+6,4
+6,3
+6,4
+5,4
+5,3
+5,2
+6,2
+6,1"
+
+# 35
+run_test "test_01.txt" "--mem-report --low-memory --goto 3 7 1 1" "3,7
+2,7
+2,6
+2,5
+2,4
+1,4
+1,3
+1,2
+1,1"
+
+# rendering
+# 36
+run_test "test_01.txt test_render.ppm --lpath 3 7" "--render" "Rendered 64x84 pixels, path 29 cells"
+
+# 37
+check_file "test_render.ppm" "1329495591 16141"
+
+# 38
+run_test "test_01.txt test_render.ppm" "--render" "Rendered 64x84 pixels, path 0 cells"
+
+# 39
+check_file "test_render.ppm" "3295607023 16141"
+
+# 18 rows are three bands of 8 rows, with one thread they are drawn in two groups
+echo -e "18 7\n7 1 4 4 6 3 7\n7 3 1 4 4 2 3\n4 6 3 1 4 4 2\n1 4 6 3 1 4 6\n1 0 4 6 3 1 6\n7 1 0 4 6 3 3\n7 7 1 0 4 6 3\n1 6 7 1 0 4 6\n1 0 6 7 1 0 6\n5 0 0 6 7 1 2\n7 5 0 0 6 7 3\n2 7 5 0 0 6 7\n1 2 7 5 0 0 6\n5 0 2 7 5 0 2\n5 4 0 2 7 5 2\n3 5 4 0 2 7 5\n3 3 5 4 0 2 7\n5 2 7 5 4 0 6" > test_12.txt
+
+# 40
+export MAZE_THREADS=1
+run_test "test_12.txt test_render.ppm --rpath 12 1" "--render" "Rendered 64x252 pixels, path 22 cells"
+unset MAZE_THREADS
+
+# 41
+check_file "test_render.ppm" "1624985645 48398"
+
 # print test results
 if [[ "$correct" == "$test_count" ]]; then
     echo -e "\nPassed $correct / $test_count 🎉"
@@ -530,6 +800,11 @@ fi
 # if you want individual tests comment line with the test you want to keep
 # make sure to later uncomment tho :D
 
+rm -r test_dir
+rm test_pruned.txt
+rm -f test_ckpt.txt
+rm test_render.ppm
+rm test_12.txt
 rm test_11.txt
 rm test_10.txt
 rm test_09.txt